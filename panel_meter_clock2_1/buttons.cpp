@@ -0,0 +1,125 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Adjust buttons, see buttons.h. The pin change interrupts wake the loop
+// on each edge, bounces included, and the level is sampled then and on
+// the timer until it settles.
+//
+
+#include "hal.h"
+#include "buttons.h"
+#include "softclock.h"
+#include "tz.h"
+
+#define BUTTON_HOUR 0
+#define BUTTON_MINUTE 1
+
+struct Button {
+    bool level;             // as last sampled
+    bool down;              // debounced
+    unsigned long changed;  // millis() the level last changed
+    unsigned long next;     // and of the next repeat
+    uint8_t repeats;
+};
+
+static Button buttons[2];
+
+//
+// step the time for a press or a repeat
+//
+
+static void buttonStep(uint8_t button, uint8_t repeats) {
+    if (button == BUTTON_HOUR) {
+        softClockShift(3600);
+        return;
+    }
+
+    uint8_t unit = 1;
+
+    if (repeats >= 2*BUTTON_ACCELERATE)
+        unit = 15;
+    else if (repeats >= BUTTON_ACCELERATE)
+        unit = 5;
+
+    // to the next multiple of the unit on the local time
+    uint32_t standard = softClockSeconds();
+    uint8_t minute = (standard+tzShift(standard)*60L)/60 % 60;
+
+    softClockShift((unit-minute % unit)*60L);
+}
+
+//
+// debounce and repeat one button, returns true if it stepped
+//
+
+static bool buttonUpdate(uint8_t button, bool level, unsigned long now) {
+    Button *state = &buttons[button];
+
+    if (level != state->level) {
+        state->level = level;
+        state->changed = now;
+    }
+
+    if (state->level != state->down) {
+        if (now-state->changed < BUTTON_DEBOUNCE)
+            return false;
+
+        state->down = state->level;
+        if (!state->down)
+            return false;
+
+        state->next = now+BUTTON_REPEAT_DELAY;
+        state->repeats = 0;
+        buttonStep(button, 0);
+        return true;
+    }
+
+    if (state->down && (long)(now-state->next) >= 0) {
+        state->next += BUTTON_REPEAT_RATE;
+        if (state->repeats < 2*BUTTON_ACCELERATE)
+            state->repeats++;
+        buttonStep(button, state->repeats);
+        return true;
+    }
+
+    return false;
+}
+
+//
+// sample the buttons, returns true if the time has been stepped
+//
+
+bool buttonsUpdate() {
+    unsigned long now = millis();
+    bool stepped = buttonUpdate(BUTTON_HOUR, halHourButton(), now);
+
+    stepped |= buttonUpdate(BUTTON_MINUTE, halMinuteButton(), now);
+
+    if (!buttonsBusy())
+        softClockCommit();
+
+    return stepped;
+}
+
+//
+// true while either button is down or settling, including a bounce back
+// to where it was, so the timer samples it until it has been steady
+//
+
+bool buttonsBusy() {
+    unsigned long now = millis();
+
+    for (uint8_t button = 0; button < 2; button++) {
+        Button *state = &buttons[button];
+
+        if (state->down || state->level != state->down || now-state->changed < BUTTON_DEBOUNCE)
+            return true;
+    }
+
+    return false;
+}
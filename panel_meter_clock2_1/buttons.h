@@ -0,0 +1,35 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#ifndef __BUTTONS_H__
+#define __BUTTONS_H__
+
+#include "hal.h"
+
+//
+// Hour and minute adjust buttons.
+//
+// A press steps the time as soon as it has been steady for
+// BUTTON_DEBOUNCE ms. Held, it repeats after BUTTON_REPEAT_DELAY ms every
+// BUTTON_REPEAT_RATE ms, the minute button stepping 1 minute at a time
+// for BUTTON_ACCELERATE repeats, then to the next 5 minutes, then to the
+// next 15. The steps shift the soft clock and the RTC is written once
+// when both buttons are let go.
+//
+// buttonsUpdate() is called on the button and animation timer events,
+// the timer needs to run every NEEDLE_STEP ms while buttonsBusy().
+//
+
+#define BUTTON_DEBOUNCE 40
+#define BUTTON_REPEAT_DELAY 500
+#define BUTTON_REPEAT_RATE 250
+#define BUTTON_ACCELERATE 8
+
+extern bool buttonsUpdate();
+extern bool buttonsBusy();
+
+#endif
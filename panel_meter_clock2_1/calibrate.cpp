@@ -0,0 +1,200 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Least squares meter calibration, see calibrate.h
+//
+
+#include "hal.h"
+#include "config.h"
+#include "needle.h"
+#include "calibrate.h"
+
+#define MAX_TERMS (CAL_CUBIC+1)
+
+static uint8_t marks[2][8];     // a bit for each position
+
+static uint8_t lastPosition(uint8_t meter) {
+    return meter == NEEDLE_HOUR ? 12 : 60;
+}
+
+static uint16_t *calTable(uint8_t meter) {
+    return meter == NEEDLE_HOUR ? HOURS_CAL : MINUTES_CAL;
+}
+
+//
+// the marked points
+//
+
+void calMark(uint8_t meter, uint8_t position, bool marked) {
+    uint8_t bit = 1 << (position & 7);
+
+    if (marked)
+        marks[meter][position >> 3] |= bit;
+    else
+        marks[meter][position >> 3] &= ~bit;
+}
+
+bool calMarked(uint8_t meter, uint8_t position) {
+    return marks[meter][position >> 3] & (1 << (position & 7));
+}
+
+void calClear(uint8_t meter) {
+    memset(marks[meter], 0, sizeof(marks[meter]));
+}
+
+//
+// positions are scaled to -1 to 1, which keeps the normal equations
+// well enough conditioned for single precision
+//
+
+static float scaled(uint8_t position, uint8_t last) {
+    return 2.0f*position/last-1;
+}
+
+static float polynomial(const float *terms, uint8_t count, float x) {
+    float value = 0;
+
+    for (int8_t n = count-1; n >= 0; n--)
+        value = value*x+terms[n];
+
+    return value;
+}
+
+//
+// fit the meter to its marked points, in counts, and work its table out
+// again from the fit. The order comes down to one less than the points
+// when there are too few for it. Returns false and leaves the table as
+// it was with fewer than two points.
+//
+
+bool calFit(uint8_t meter, uint8_t order, CalFit *fit) {
+    uint8_t last = lastPosition(meter);
+    uint16_t *table = calTable(meter);
+    float normal[MAX_TERMS][MAX_TERMS+1];   // the normal equations and their sums
+    float terms[MAX_TERMS];
+    uint8_t points = 0;
+    uint8_t count;
+
+    for (uint8_t position = 0; position <= last; position++) {
+        if (calMarked(meter, position))
+            points++;
+    }
+
+    if (points < 2)
+        return false;
+
+    order = constrain(order, CAL_LINEAR, CAL_CUBIC);
+    if (order > points-1)
+        order = points-1;
+    count = order+1;
+
+    memset(normal, 0, sizeof(normal));
+
+    for (uint8_t position = 0; position <= last; position++) {
+        if (!calMarked(meter, position))
+            continue;
+
+        float x = scaled(position, last);
+        float value = table[position]/16.0f;
+        float powers[2*MAX_TERMS-1];
+
+        powers[0] = 1;
+        for (uint8_t n = 1; n < 2*count-1; n++)
+            powers[n] = powers[n-1]*x;
+
+        for (uint8_t row = 0; row < count; row++) {
+            for (uint8_t col = 0; col < count; col++)
+                normal[row][col] += powers[row+col];
+            normal[row][count] += value*powers[row];
+        }
+    }
+
+    // Gaussian elimination with partial pivoting
+
+    for (uint8_t col = 0; col < count; col++) {
+        uint8_t pivot = col;
+
+        for (uint8_t row = col+1; row < count; row++) {
+            if (fabs(normal[row][col]) > fabs(normal[pivot][col]))
+                pivot = row;
+        }
+
+        if (fabs(normal[pivot][col]) < 1e-6f)
+            return false;
+
+        for (uint8_t n = 0; n <= count; n++) {
+            float swap = normal[col][n];
+            normal[col][n] = normal[pivot][n];
+            normal[pivot][n] = swap;
+        }
+
+        for (uint8_t row = col+1; row < count; row++) {
+            float factor = normal[row][col]/normal[col][col];
+
+            for (uint8_t n = col; n <= count; n++)
+                normal[row][n] -= factor*normal[col][n];
+        }
+    }
+
+    for (int8_t row = count-1; row >= 0; row--) {
+        float sum = normal[row][count];
+
+        for (uint8_t n = row+1; n < count; n++)
+            sum -= normal[row][n]*terms[n];
+
+        terms[row] = sum/normal[row][row];
+    }
+
+    // the residual at the marked points, then the table from the fit
+
+    float squares = 0;
+
+    fit->points = points;
+    fit->order = order;
+    fit->worst = 0;
+
+    for (uint8_t position = 0; position <= last; position++) {
+        float value = polynomial(terms, count, scaled(position, last));
+
+        if (calMarked(meter, position)) {
+            float residual = fabs(value-table[position]/16.0f);
+
+            squares += residual*residual;
+            if (residual > fit->worst)
+                fit->worst = residual;
+        }
+    }
+
+    fit->rms = sqrt(squares/points);
+
+    for (uint8_t position = 0; position <= last; position++) {
+        float value = polynomial(terms, count, scaled(position, last))*16;
+
+        table[position] = constrain(lround(value), 0L, 0xFFFFL);
+    }
+
+    needleFit();
+    return true;
+}
+
+//
+// fill in the minutes either side of a five minute mark in a straight
+// line, rounded to the nearest 1/16th
+//
+
+void calFill(uint8_t minute) {
+    uint8_t from = minute >= 5 ? minute-5 : 0;
+
+    for (; from <= minute && from < 60; from += 5) {
+        int32_t first = MINUTES_CAL[from];
+        int32_t difference = (int32_t)MINUTES_CAL[from+5]-first;
+
+        for (uint8_t tick = 1; tick < 5; tick++)
+            MINUTES_CAL[from+tick] = first+(difference*tick*2+(difference < 0 ? -5 : 5))/10;
+    }
+}
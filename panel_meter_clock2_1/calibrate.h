@@ -0,0 +1,45 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#ifndef __CALIBRATE_H__
+#define __CALIBRATE_H__
+
+#include "hal.h"
+
+//
+// Least squares calibration of the meters.
+//
+// Points set by hand in the menu are marked with calMark(), as few as
+// two of them, and calFit() fits a polynomial in the position through
+// them, an offset and gain with the linear fit and the curve of the
+// meter's movement with the higher orders. The whole of HOURS_CAL or
+// MINUTES_CAL is then worked out again from the fit, rounded to the
+// nearest 1/16th of a count, and the residual at the marked points
+// reported.
+//
+// The meters are NEEDLE_HOUR and NEEDLE_MINUTE, positions the hour 0-12
+// and the minute 0-60.
+//
+
+#define CAL_LINEAR 1
+#define CAL_QUADRATIC 2
+#define CAL_CUBIC 3
+
+struct CalFit {
+    uint8_t points;         // marked points fitted
+    uint8_t order;          // and the order fitted to them
+    float rms;              // residual at the points in counts
+    float worst;
+};
+
+extern void calMark(uint8_t meter, uint8_t position, bool marked);
+extern bool calMarked(uint8_t meter, uint8_t position);
+extern void calClear(uint8_t meter);
+extern bool calFit(uint8_t meter, uint8_t order, CalFit *fit);
+extern void calFill(uint8_t minute);
+
+#endif
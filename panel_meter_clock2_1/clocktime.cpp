@@ -0,0 +1,109 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Time fields by carry, see clocktime.h
+//
+
+#include "hal.h"
+#include "clocktime.h"
+
+static const uint8_t DAYS_IN_MONTH[12] PROGMEM = {
+    31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+};
+
+static uint8_t daysInMonth(uint16_t year, uint8_t month) {
+    // 2000-2099, where every fourth year is a leap year
+    if (month == 2 && year % 4 == 0)
+        return 29;
+
+    return pgm_read_byte(&DAYS_IN_MONTH[month-1]);
+}
+
+//
+// work the fields out from scratch
+//
+
+void clockTimeSet(ClockTime *time, uint32_t seconds) {
+    DateTime date(seconds);
+
+    time->seconds = seconds;
+    time->year = date.year();
+    time->month = date.month();
+    time->day = date.day();
+    time->hour = date.hour();
+    time->minute = date.minute();
+    time->second = date.second();
+    time->dayOfWeek = date.dayOfTheWeek();
+}
+
+//
+// move the time on to seconds
+//
+
+void clockTimeTo(ClockTime *time, uint32_t seconds) {
+    uint32_t step = seconds-time->seconds;
+
+    // backwards wraps round to more than a day
+    if (step >= 86400L) {
+        clockTimeSet(time, seconds);
+        return;
+    }
+
+    time->seconds = seconds;
+
+    // a step of less than a day carries at most one day, the divisions
+    // are skipped for the usual second
+
+    uint8_t hours = 0;
+    uint8_t minutes = 0;
+    uint16_t rest = step;
+    uint8_t carry;
+
+    if (step >= 3600) {
+        hours = step/3600;
+        rest = step % 3600;
+    }
+
+    if (rest >= 60) {
+        minutes = rest/60;
+        rest %= 60;
+    }
+
+    time->second += rest;
+    carry = time->second >= 60;
+    if (carry)
+        time->second -= 60;
+
+    time->minute += minutes+carry;
+    carry = time->minute >= 60;
+    if (carry)
+        time->minute -= 60;
+
+    time->hour += hours+carry;
+    if (time->hour < 24)
+        return;
+    time->hour -= 24;
+
+    time->dayOfWeek = time->dayOfWeek == 6 ? 0 : time->dayOfWeek+1;
+    if (++time->day <= daysInMonth(time->year, time->month))
+        return;
+    time->day = 1;
+
+    if (++time->month <= 12)
+        return;
+    time->month = 1;
+    time->year++;
+}
+
+//
+// as a DateTime for the RTC and the menu
+//
+
+DateTime clockTimeDate(const ClockTime *time) {
+    return DateTime(time->seconds);
+}
@@ -0,0 +1,43 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#ifndef __CLOCKTIME_H__
+#define __CLOCKTIME_H__
+
+#include "hal.h"
+
+//
+// The time as seconds since 1970 with its fields kept alongside.
+//
+// clockTimeTo() moves the fields on by carrying from the seconds up when
+// the time steps forward by less than a day, as it does each tick, and
+// only works them out from scratch for a longer or a backward step.
+// DateTime is left to the RTC and the menu, see clockTimeDate().
+//
+
+struct ClockTime {
+    uint32_t seconds;       // since 1970
+    uint16_t year;
+    uint8_t month;          // 1-12
+    uint8_t day;            // 1-31
+    uint8_t hour;           // 0-23
+    uint8_t minute;
+    uint8_t second;
+    uint8_t dayOfWeek;      // 0 for Sunday
+};
+
+extern void clockTimeSet(ClockTime *time, uint32_t seconds);
+extern void clockTimeTo(ClockTime *time, uint32_t seconds);
+extern DateTime clockTimeDate(const ClockTime *time);
+
+// seconds past midnight
+
+static inline long clockTimeOfDay(const ClockTime *time) {
+    return time->hour*3600L+time->minute*60+time->second;
+}
+
+#endif
@@ -8,6 +8,30 @@
 
 #include <math.h>
 #include "colourcalc.h"
+#include "fastmath.h"
+
+//maths used by the model, the fast approximations or libm as set in fastmath.h
+#if FAST_MATH
+static inline float perez_exp(float x) { return fast_exp(x); }
+static inline float perez_sin(float x) { return fast_sin(x); }
+static inline float perez_cos(float x) { return fast_cos(x); }
+static inline float perez_tan(float x) { return fast_tan(x); }
+static inline float perez_acos(float x) { return fast_acos(x); }
+static inline float perez_pow(float x, int n)
+{
+    float p = x;
+    while (--n)
+        p *= x;
+    return p;
+}
+#else
+static inline float perez_exp(float x) { return exp(x); }
+static inline float perez_sin(float x) { return sin(x); }
+static inline float perez_cos(float x) { return cos(x); }
+static inline double perez_tan(double x) { return tan(x); }
+static inline float perez_acos(float x) { return acos(x); }
+static inline double perez_pow(double x, int n) { return pow(x, n); }
+#endif
 
 /*this calculates the colour and intensity of the sky NOT the sun
 so there needs to be a function to override some pixels for when the
@@ -24,29 +48,60 @@ const float perez::bx = 0.00572041;
 const float perez::by = -0.01590685;
 const float perez::bz = 1.01018641;
 
-perez_coefficient coeff; //single instance of coefficients
-
-//function returns member of class perez_Yxy_coefficients for a given turbidity
-void perez::generate_perez_coeff(float turbidity)
+//nothing cached or prepared yet
+perez::perez()
 {
+    for (int i = 0; i < PEREZ_COEFF_CACHE; i++)
+        coeff_key[i] = 0;
 
-    coeff.A[0] = .17872f * turbidity - 1.46303f;
-    coeff.B[0] = -.3554f * turbidity + .42749f;
-    coeff.C[0] = -.02266f * turbidity + 5.32505f;
-    coeff.D[0] = .12064f * turbidity - 2.57705f;
-    coeff.E[0] = -.06696f * turbidity + .37027f;
-
-    coeff.A[1] = -.01925f * turbidity - .25922f;
-    coeff.B[1] = -.06651f * turbidity + .00081f;
-    coeff.C[1] = -.00041f * turbidity + .21247f;
-    coeff.D[1] = -.06409f * turbidity - .89887f;
-    coeff.E[1] = -.00325f * turbidity + .04517f;
+    coeff_next = 0;
+    coeff = &coeff_cache[0];
+    sun.theta_sun = NAN;
+    sun.turbidity = NAN;
+}
 
-    coeff.A[2] = -.01669f * turbidity - .26078f;
-    coeff.B[2] = -.09495f * turbidity + .00921f;
-    coeff.C[2] = -.00792f * turbidity + .21023f;
-    coeff.D[2] = -.04405f * turbidity - 1.65369f;
-    coeff.E[2] = -.01092f * turbidity + .05291f;
+//select the coefficients for a turbidity, quantised to tenths, generating
+//them into the oldest cached set if they are not cached
+void perez::generate_perez_coeff(float turbidity)
+{
+    uint8_t key = (uint8_t)(turbidity * 10 + 0.5f);
+
+    //prepared terms may have used other coefficients
+    sun.theta_sun = NAN;
+    sun.turbidity = NAN;
+
+    for (int i = 0; i < PEREZ_COEFF_CACHE; i++)
+    {
+        if (coeff_key[i] == key)
+        {
+            coeff = &coeff_cache[i];
+            return;
+        }
+    }
+
+    coeff = &coeff_cache[coeff_next];
+    coeff_key[coeff_next] = key;
+    coeff_next = (coeff_next + 1) % PEREZ_COEFF_CACHE;
+
+    turbidity = key / 10.0f;
+
+    coeff->A[0] = .17872f * turbidity - 1.46303f;
+    coeff->B[0] = -.3554f * turbidity + .42749f;
+    coeff->C[0] = -.02266f * turbidity + 5.32505f;
+    coeff->D[0] = .12064f * turbidity - 2.57705f;
+    coeff->E[0] = -.06696f * turbidity + .37027f;
+
+    coeff->A[1] = -.01925f * turbidity - .25922f;
+    coeff->B[1] = -.06651f * turbidity + .00081f;
+    coeff->C[1] = -.00041f * turbidity + .21247f;
+    coeff->D[1] = -.06409f * turbidity - .89887f;
+    coeff->E[1] = -.00325f * turbidity + .04517f;
+
+    coeff->A[2] = -.01669f * turbidity - .26078f;
+    coeff->B[2] = -.09495f * turbidity + .00921f;
+    coeff->C[2] = -.00792f * turbidity + .21023f;
+    coeff->D[2] = -.04405f * turbidity - 1.65369f;
+    coeff->E[2] = -.01092f * turbidity + .05291f;
 }
 
 //angle between sun and pixel
@@ -54,7 +109,7 @@ float perez::angle_sun_pixel(float theta_sun, float theta_pixel)
 {
     float gamma;
 
-    gamma = acos(sin(theta_sun) * sin(theta_pixel) + cos(theta_sun) * cos(theta_pixel));
+    gamma = perez_acos(perez_sin(theta_sun) * perez_sin(theta_pixel) + perez_cos(theta_sun) * perez_cos(theta_pixel));
 
     return gamma;
 }
@@ -62,12 +117,21 @@ float perez::angle_sun_pixel(float theta_sun, float theta_pixel)
 //calculate Perez luminosity
 float perez::calc_perez_lum(float theta, float gamma, int n)
 {
-    theta = cos(theta);
-    float lum;
+    return calc_theta_lum(theta, n) * calc_gamma_lum(gamma, n);
+}
 
-    lum = (1 + coeff.A[n] * exp(coeff.B[n] / theta)) * (1 + coeff.C[n] * exp(coeff.D[n] * gamma) + coeff.E[n] * cos(gamma) * cos(gamma));
+//pixel factor of the Perez luminosity
+float perez::calc_theta_lum(float theta, int n)
+{
+    theta = perez_cos(theta);
 
-    return lum;
+    return 1 + coeff->A[n] * perez_exp(coeff->B[n] / theta);
+}
+
+//sun factor of the Perez luminosity
+float perez::calc_gamma_lum(float gamma, int n)
+{
+    return 1 + coeff->C[n] * perez_exp(coeff->D[n] * gamma) + coeff->E[n] * perez_cos(gamma) * perez_cos(gamma);
 }
 
 //calculate Perez colour
@@ -75,8 +139,8 @@ float perez::calc_Yz(float turbidity, float theta_sun)
 {
     float Yz;
 
-    Yz = ((4.0453 * turbidity - 4.9710) * tan((4 / 9 - turbidity / 120) * (M_PI - 2 * theta_sun)) - 0.2155 * turbidity + 2.4192) /
-         ((4.0453 * turbidity - 4.9710) * tan((4 / 9 - turbidity / 120) * M_PI) - 0.2155 * turbidity + 2.4192);
+    Yz = ((4.0453 * turbidity - 4.9710) * perez_tan((4 / 9 - turbidity / 120) * (M_PI - 2 * theta_sun)) - 0.2155 * turbidity + 2.4192) /
+         ((4.0453 * turbidity - 4.9710) * perez_tan((4 / 9 - turbidity / 120) * M_PI) - 0.2155 * turbidity + 2.4192);
 
     return Yz;
 }
@@ -84,10 +148,10 @@ float perez::calc_Yz(float turbidity, float theta_sun)
 float perez::calc_xz(float turbidity, float theta_sun)
 {
     float xz;
-    float theta_sun2 = pow(theta_sun, 2);
-    float theta_sun3 = pow(theta_sun, 3);
+    float theta_sun2 = perez_pow(theta_sun, 2);
+    float theta_sun3 = perez_pow(theta_sun, 3);
 
-    xz = (0.00166 * theta_sun3 - 0.00375 * theta_sun2 + 0.00209 * theta_sun) * pow(turbidity, 2) +
+    xz = (0.00166 * theta_sun3 - 0.00375 * theta_sun2 + 0.00209 * theta_sun) * perez_pow(turbidity, 2) +
          (-0.02903 * theta_sun3 + 0.06377 * theta_sun2 - 0.03202 * theta_sun + 0.00394) * turbidity +
          (0.11693 * theta_sun3 - 0.21196 * theta_sun2 + 0.06052 * theta_sun + 0.25886);
 
@@ -97,31 +161,50 @@ float perez::calc_xz(float turbidity, float theta_sun)
 float perez::calc_yz(float turbidity, float theta_sun)
 {
     float yz;
-    float theta_sun2 = pow(theta_sun, 2);
-    float theta_sun3 = pow(theta_sun, 3);
+    float theta_sun2 = perez_pow(theta_sun, 2);
+    float theta_sun3 = perez_pow(theta_sun, 3);
 
-    yz = (0.00275 * theta_sun3 - 0.00610 * theta_sun2 + 0.00317 * theta_sun) * pow(turbidity, 2) +
+    yz = (0.00275 * theta_sun3 - 0.00610 * theta_sun2 + 0.00317 * theta_sun) * perez_pow(turbidity, 2) +
          (-0.04214 * theta_sun3 + 0.08970 * theta_sun2 - 0.04153 * theta_sun + 0.00516) * turbidity +
          (0.15346 * theta_sun3 - 0.26756 * theta_sun2 + 0.06670 * theta_sun + 0.26688);
 
     return yz;
 }
 
-//calc CIE XYZ values
-void perez::calc_XYZ(CIE_XYZ *temp_XYZ, float turbidity, float theta_sun, float theta_pix)
+//cache the terms that depend only on the sun, skipped if the sun has not moved
+void perez::prepare(float theta_sun, float turbidity)
 {
+    if (theta_sun == sun.theta_sun && turbidity == sun.turbidity)
+        return;
 
-    CIE_Yxy temp_Yxy; //generate instance
+    if (turbidity != sun.turbidity)
+        generate_perez_coeff(turbidity);
+
+    sun.theta_sun = theta_sun;
+    sun.turbidity = turbidity;
 
     //calculate colour coefficients
-    float Yz = calc_Yz(turbidity, theta_sun);
-    float xz = calc_xz(turbidity, theta_sun);
-    float yz = calc_yz(turbidity, theta_sun);
+    sun.Yz = calc_Yz(turbidity, theta_sun);
+    sun.xz = calc_xz(turbidity, theta_sun);
+    sun.yz = calc_yz(turbidity, theta_sun);
+
+    for (int n = 0; n < 3; n++)
+    {
+        sun.gamma_lum[n] = calc_gamma_lum(theta_sun, n);
+        sun.zenith_lum[n] = calc_perez_lum(0, theta_sun, n);
+    }
+}
+
+//calc CIE XYZ values for the prepared sun
+void perez::calc_XYZ(CIE_XYZ *temp_XYZ, float theta_pix)
+{
 
-    //calculate CIE Yxy values
-    temp_Yxy.Y = Yz * calc_perez_lum(theta_pix, theta_sun, 0) / calc_perez_lum(0, theta_sun, 0);
-    temp_Yxy.x = xz * calc_perez_lum(theta_pix, theta_sun, 1) / calc_perez_lum(0, theta_sun, 1);
-    temp_Yxy.y = yz * calc_perez_lum(theta_pix, theta_sun, 2) / calc_perez_lum(0, theta_sun, 2);
+    CIE_Yxy temp_Yxy; //generate instance
+
+    //calculate CIE Yxy values, only the pixel factor of the luminosity is new
+    temp_Yxy.Y = sun.Yz * (calc_theta_lum(theta_pix, 0) * sun.gamma_lum[0]) / sun.zenith_lum[0];
+    temp_Yxy.x = sun.xz * (calc_theta_lum(theta_pix, 1) * sun.gamma_lum[1]) / sun.zenith_lum[1];
+    temp_Yxy.y = sun.yz * (calc_theta_lum(theta_pix, 2) * sun.gamma_lum[2]) / sun.zenith_lum[2];
 
     //calculate CIE XYZ values
     temp_XYZ->X = (temp_Yxy.x / temp_Yxy.y) * temp_Yxy.Y;
@@ -144,13 +227,59 @@ void perez::calc_RGB(RGB_value *temp_RGB, CIE_XYZ *temp_XYZ, float theta_sun)
     temp_RGB->B = temp_RGB->B / divisor;
 }
 
-RGB_value perez::calc_RGB_out(float theta_sun, float theta_pixel, float turbidity)
+//colour for a pixel, prepare() must have been called for the sun position
+RGB_value perez::calc_RGB_pixel(float theta_pixel)
 {
     CIE_XYZ temp_XYZ;
     RGB_value temp_RGB;
 
-    calc_XYZ(&temp_XYZ, turbidity, theta_sun, theta_pixel);
-    calc_RGB(&temp_RGB, &temp_XYZ, theta_sun);
+    calc_XYZ(&temp_XYZ, theta_pixel);
+    calc_RGB(&temp_RGB, &temp_XYZ, sun.theta_sun);
 
     return temp_RGB; //scaling and gamma correction done before sending to the LEDs
 }
+
+//colours for count pixels with the prepared sun, R, G and B are separate
+//arrays and each pixel is independent so the loop vectorises on the host
+void perez::calc_RGB_batch(const float *__restrict__ theta_pixel,
+                           float *__restrict__ R, float *__restrict__ G, float *__restrict__ B, int count)
+{
+    //sun dependent part of each of Y, x and y
+    float kY = sun.Yz * sun.gamma_lum[0] / sun.zenith_lum[0];
+    float kx = sun.xz * sun.gamma_lum[1] / sun.zenith_lum[1];
+    float ky = sun.yz * sun.gamma_lum[2] / sun.zenith_lum[2];
+
+    float A0 = coeff->A[0], A1 = coeff->A[1], A2 = coeff->A[2];
+    float B0 = coeff->B[0], B1 = coeff->B[1], B2 = coeff->B[2];
+
+    for (int i = 0; i < count; i++)
+    {
+        float theta = perez_cos(theta_pixel[i]);
+
+        //calculate CIE Yxy values
+        float Y = kY * (1 + A0 * perez_exp(B0 / theta));
+        float x = kx * (1 + A1 * perez_exp(B1 / theta));
+        float y = ky * (1 + A2 * perez_exp(B2 / theta));
+
+        //calculate CIE XYZ values
+        float X = (x / y) * Y;
+        float Z = (1 - x - y) / (y * Y);
+
+        //convert CIE XYZ to RGB and normalise
+        float r = (rx * X) + (ry * Y) + (rz * Z);
+        float g = (gx * X) + (gy * Y) + (gz * Z);
+        float b = (bx * X) + (by * Y) + (bz * Z);
+
+        float divisor = fmax(1.0f, fmax(r, fmax(g, b)));
+        R[i] = r / divisor;
+        G[i] = g / divisor;
+        B[i] = b / divisor;
+    }
+}
+
+RGB_value perez::calc_RGB_out(float theta_sun, float theta_pixel, float turbidity)
+{
+    prepare(theta_sun, turbidity);
+
+    return calc_RGB_pixel(theta_pixel);
+}
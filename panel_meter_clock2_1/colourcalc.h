@@ -12,6 +12,9 @@
 #include <math.h> //include math functions
 #include <stdint.h>
 
+//number of coefficient sets kept, so switching between recent turbidities is free
+#define PEREZ_COEFF_CACHE 3
+
 //data structure for coefficients
 struct perez_coefficient
 {
@@ -40,15 +43,34 @@ struct RGB_value
     float R, G, B;
 };
 
+//data structure for the terms that depend only on the sun, not the pixel
+struct perez_sun_terms
+{
+    float theta_sun, turbidity; //values the terms were prepared for
+    float Yz, xz, yz;           //zenith colour
+    float gamma_lum[3];         //sun factor of the Perez luminosity
+    float zenith_lum[3];        //normalisation, Perez luminosity at the zenith
+};
+
 class perez
 {
 
 public:
+    perez();
+
     //function prototypes
-    void generate_perez_coeff(float turbidity); //only needed once at initiation
+    void generate_perez_coeff(float turbidity); //select the coefficients, generated if not cached
+    void prepare(float theta_sun, float turbidity); //once per sun position, repeats are skipped
+    RGB_value calc_RGB_pixel(float theta_pixel); //colour for a pixel with the prepared sun
+    void calc_RGB_batch(const float *theta_pixel, float *R, float *G, float *B, int count); //colours for many pixels with the prepared sun
     RGB_value calc_RGB_out(float theta_sun, float theta_pixel, float turbidity);
 
 private:
+    perez_coefficient coeff_cache[PEREZ_COEFF_CACHE]; //coefficient sets
+    uint8_t coeff_key[PEREZ_COEFF_CACHE];             //and their turbidity in tenths, 0 unused
+    uint8_t coeff_next;                               //set to replace next
+    perez_coefficient *coeff;                         //set in use
+
     //define CIE to RGB scaling constants, set actual values in the body .cpp file
     static const float rx;
     static const float ry;
@@ -60,13 +82,17 @@ private:
     static const float by;
     static const float bz;
 
+    perez_sun_terms sun; //terms cached by prepare()
+
     //function prototypes
     float angle_sun_pixel(float theta_sun, float theta_pixel);
     float calc_perez_lum(float theta, float gamma, int n);
+    float calc_theta_lum(float theta, int n);
+    float calc_gamma_lum(float gamma, int n);
     float calc_Yz(float turbidity, float theta_sun);
     float calc_xz(float turbidity, float theta_sun);
     float calc_yz(float turbidity, float theta_sun);
-    void calc_XYZ(CIE_XYZ *temp_XYZ, float turbidity, float theta_sun, float theta_pix);
+    void calc_XYZ(CIE_XYZ *temp_XYZ, float theta_pix);
     void calc_RGB(RGB_value *temp_RGB, CIE_XYZ *temp_XYZ, float theta_sun);
 };
 
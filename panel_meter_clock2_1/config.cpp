@@ -5,39 +5,47 @@
 // Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
 //
 
-#include <Arduino.h>
-#include <avr/pgmspace.h>
-#include <EEPROM.h>
-#include <RTClib.h>
-#include <Adafruit_NeoPixel.h>
-
+#include "hal.h"
 #include "config.h"
+#include "softclock.h"
+#include "needle.h"
+#include "calibrate.h"
+#include "tz.h"
+#include "sun.h"
+
+#include <stddef.h>
 
 extern void updateMinute(uint16_t value);
+extern SolarEvents events;
 
 //
 // global configuration values
 //
 
-uint8_t HOURS_CAL[13] = {
-    8, 27, 45, 64, 82, 102, 119, 136, 154, 171, 190, 207, 227
+uint16_t HOURS_CAL[13] = {
+    512, 1728, 2896, 4112, 5264, 6544, 7632, 8736, 9888, 10976, 12192, 13296, 14560
 };
 
 uint16_t MINUTES_CAL[61] = {
-      96,  129,  162,  195,  228,  264,  296,  328,  360,  392,
-     428,  460,  492,  524,  556,  590,  622,  654,  686,  718,
-     754,  785,  816,  847,  878,  911,  943,  975, 1007, 1039,
-    1074, 1105, 1136, 1167, 1198, 1232, 1262, 1292, 1322, 1352,
-    1386, 1415, 1444, 1473, 1502, 1535, 1564, 1593, 1622, 1651,
-    1684, 1714, 1744, 1774, 1804, 1838, 1868, 1898, 1928, 1958,
-    1988
+     1536,  2064,  2592,  3120,  3648,  4224,  4736,  5248,  5760,  6272,
+     6848,  7360,  7872,  8384,  8896,  9440,  9952, 10464, 10976, 11488,
+    12064, 12560, 13056, 13552, 14048, 14576, 15088, 15600, 16112, 16624,
+    17184, 17680, 18176, 18672, 19168, 19712, 20192, 20672, 21152, 21632,
+    22176, 22640, 23104, 23568, 24032, 24560, 25024, 25488, 25952, 26416,
+    26944, 27424, 27904, 28384, 28864, 29408, 29888, 30368, 30848, 31328,
+    31808
 };
 
 uint8_t globScale = 255;
 
 uint8_t colorMode = DEFAULT_COLOR_MODE;
-int8_t gmtOffset = DEFAULT_GMT_OFFSET;
-uint8_t dstObs = DEFAULT_DST_OBSERVED;
+uint8_t turbiditySetting = DEFAULT_TURBIDITY;
+uint8_t sweepTime = DEFAULT_SWEEP_TIME;
+uint8_t sweepEasing = DEFAULT_SWEEP_EASING;
+uint8_t glide = DEFAULT_GLIDE;
+uint8_t shaper = DEFAULT_SHAPER;
+uint8_t meterFrequency[2] = {DEFAULT_FREQUENCY, DEFAULT_FREQUENCY};
+uint8_t meterDamping[2] = {DEFAULT_DAMPING, DEFAULT_DAMPING};
 
 uint8_t r = DEFAULT_R;
 uint8_t g = DEFAULT_G;
@@ -45,11 +53,12 @@ uint8_t b = DEFAULT_B;
 
 char aLatitude[MAX_LOC_LEN+1];
 char aLongitude[MAX_LOC_LEN+1];
+char aTimeZone[MAX_TZ_LEN+1];
 
 float longitude;
 float latitude;
 
-DateTime theTime;
+ClockTime theTime;
 
 //
 // resetTimeFlags:
@@ -60,72 +69,185 @@ void resetTimeFlags() {
 	lastDay = -1;
 	lastHour = -1;
 	lastMinute = -1;
+	lastSecond = -1;
 	colorStep = 0;
 }
 
 //
-// Load calibration data from EEPROM
+// CRC-16/CCITT, a byte at a time by shifts in place of the 8 steps
+// of the polynomial 0x1021
 //
 
-void configLoad() {
+static uint16_t configCrc(const ConfigRecord *record) {
+	const uint8_t *bytes = (const uint8_t *) record;
+	uint16_t crc = 0xffff;
+
+	for (uint16_t n = 0; n < offsetof(ConfigRecord, crc); n++) {
+		crc = (crc >> 8) | (crc << 8);
+		crc ^= bytes[n];
+		crc ^= (crc & 0xff) >> 4;
+		crc ^= crc << 12;
+		crc ^= (crc & 0xff) << 5;
+	}
+
+	return crc;
+}
+
+//
+// Load the version 0 fields, the settings as they were saved before the
+// record. The calibration is scaled up to the 10 bit hour meter and to
+// fractions of a count, the time zone is made from the whole hour GMT
+// offset and US DST, and the settings added since take their defaults.
+//
+
+static void configMigrate() {
 	for (uint8_t val = 0; val < 13; val++) {
-		EEPROM.get(val + EEPROM_HOURS_CAL, HOURS_CAL[val]);
+		uint8_t pwm = halStorageRead(val + EEPROM_HOURS_CAL);
+		HOURS_CAL[val] = ((pwm << 2) | (pwm >> 6)) << METER_FRACTION_BITS;
 	}
 
 	for (uint8_t val = 0; val < 61; val++) {
-		EEPROM.get(val*2 + EEPROM_MINUTES_CAL, MINUTES_CAL[val]);
+		halStorageGet(val*2 + EEPROM_MINUTES_CAL, MINUTES_CAL[val]);
+		MINUTES_CAL[val] <<= METER_FRACTION_BITS;
 	}
 
-	EEPROM.get(EEPROM_COLOR_MODE, colorMode);
-	EEPROM.get(EEPROM_GLOB_SCALE, globScale);
-    EEPROM.get(EEPROM_GMT_OFFSET, gmtOffset);
-    EEPROM.get(EEPROM_DST_OBS, dstObs);
-    EEPROM.get(EEPROM_NEOPIXEL_R, r);
-	EEPROM.get(EEPROM_NEOPIXEL_G, g);
-	EEPROM.get(EEPROM_NEOPIXEL_B, b);
+	halStorageGet(EEPROM_COLOR_MODE, colorMode);
+	halStorageGet(EEPROM_GLOB_SCALE, globScale);
+    halStorageGet(EEPROM_NEOPIXEL_R, r);
+	halStorageGet(EEPROM_NEOPIXEL_G, g);
+	halStorageGet(EEPROM_NEOPIXEL_B, b);
+
+	turbiditySetting = DEFAULT_TURBIDITY;
+	sweepTime = DEFAULT_SWEEP_TIME;
+	sweepEasing = DEFAULT_SWEEP_EASING;
+	glide = DEFAULT_GLIDE;
+	shaper = DEFAULT_SHAPER;
+
+	for (uint8_t meter = 0; meter < 2; meter++) {
+		meterFrequency[meter] = DEFAULT_FREQUENCY;
+		meterDamping[meter] = DEFAULT_DAMPING;
+	}
+
+	int8_t offset;
+	uint8_t observed;
+
+	halStorageGet(EEPROM_GMT_OFFSET, offset);
+	halStorageGet(EEPROM_DST_OBS, observed);
+	memset(aTimeZone, 0, MAX_TZ_LEN+1);
+	sprintf(aTimeZone, observed ? "STD%dDST,M3.2.0,M11.1.0" : "STD%d", -offset);
 
 	for (int addr=0; addr < MAX_LOC_LEN; addr++) {
-		aLatitude[addr] = EEPROM[EEPROM_LATITUDE+addr];
-		aLongitude[addr] = EEPROM[EEPROM_LONGITUDE+addr];
+		aLatitude[addr] = halStorageRead(EEPROM_LATITUDE+addr);
+		aLongitude[addr] = halStorageRead(EEPROM_LONGITUDE+addr);
 	}
 
-	aLatitude[EEPROM_LATITUDE+MAX_LOC_LEN+1] = 0;
-	aLongitude[EEPROM_LONGITUDE+MAX_LOC_LEN+1] = 0;
-
-	latitude = atof(aLatitude);
-	longitude = atof(aLongitude);
+	aLatitude[MAX_LOC_LEN] = 0;
+	aLongitude[MAX_LOC_LEN] = 0;
 }
 
 //
-// Save calibration data to EEPROM after calculating values between 5 minute marks
-// and print C code for the default values that can be used in this program.
+// Load the settings from EEPROM, carrying version 0 forward into a record
+// and putting a bad or missing one back to the defaults
 //
 
-void configSave() {
-	// calculate values between 5 minute marks
+void configLoad() {
+	ConfigRecord record;
 
-	for (int val = 5; val < 61; val +=5) {
-		int first = MINUTES_CAL[val-5];
-		int difference = MINUTES_CAL[val] - first;
-		int step = difference / 5;
+	halStorageGet(EEPROM_CONFIG, record);
 
-		for (int tick = 1; tick < 5; tick++) {
-			MINUTES_CAL[val+tick-5] = first + step * tick;
+	if (memcmp(record.sentinel, "PMC", 3) == 0) {
+		if (record.version != CONFIG_VERSION || record.crc != configCrc(&record)) {
+			configCreate();
+			halStorageGet(EEPROM_CONFIG, record);
 		}
+	} else if (halStorageRead(EEPROM_SENTINEL) == 'P' && halStorageRead(EEPROM_SENTINEL+1) == 'M' &&
+		halStorageRead(EEPROM_SENTINEL+2) == 'C') {
+		configMigrate();
+		configWrite();
+		halStorageGet(EEPROM_CONFIG, record);
+	} else {
+		configCreate();
+		halStorageGet(EEPROM_CONFIG, record);
+	}
+
+	memcpy(HOURS_CAL, record.hoursCal, sizeof(HOURS_CAL));
+	memcpy(MINUTES_CAL, record.minutesCal, sizeof(MINUTES_CAL));
+	colorMode = record.colorMode;
+	globScale = record.globScale;
+	r = record.r;
+	g = record.g;
+	b = record.b;
+	turbiditySetting = record.turbidity;
+	sweepTime = record.sweepTime;
+	sweepEasing = record.sweepEasing;
+	glide = record.glide;
+	shaper = record.shaper;
+	memcpy(meterFrequency, record.frequency, sizeof(meterFrequency));
+	memcpy(meterDamping, record.damping, sizeof(meterDamping));
+	memcpy(aLatitude, record.latitude, sizeof(aLatitude));
+	memcpy(aLongitude, record.longitude, sizeof(aLongitude));
+	memcpy(aTimeZone, record.timeZone, sizeof(aTimeZone));
+
+	needleFit();
+	needleShape();
+
+	if (!tzSet(aTimeZone)) {
+		strcpy(aTimeZone, DEFAULT_TIME_ZONE);
+		tzSet(aTimeZone);
 	}
 
-	EEPROM[EEPROM_SENTINEL]   = 'P';
-	EEPROM[EEPROM_SENTINEL+1] = 'M';
-	EEPROM[EEPROM_SENTINEL+2] = 'C';
+	latitude = atof(aLatitude);
+	longitude = atof(aLongitude);
+}
+
+//
+// Write the settings to EEPROM as a record, only the bytes that have
+// changed are written
+//
+
+void configWrite() {
+	ConfigRecord record;
+
+	memcpy(record.sentinel, "PMC", 3);
+	record.version = CONFIG_VERSION;
+	memcpy(record.hoursCal, HOURS_CAL, sizeof(HOURS_CAL));
+	memcpy(record.minutesCal, MINUTES_CAL, sizeof(MINUTES_CAL));
+	record.colorMode = colorMode;
+	record.globScale = globScale;
+	record.r = r;
+	record.g = g;
+	record.b = b;
+	record.turbidity = turbiditySetting;
+	record.sweepTime = sweepTime;
+	record.sweepEasing = sweepEasing;
+	record.glide = glide;
+	record.shaper = shaper;
+	memcpy(record.frequency, meterFrequency, sizeof(meterFrequency));
+	memcpy(record.damping, meterDamping, sizeof(meterDamping));
+	memcpy(record.latitude, aLatitude, sizeof(aLatitude));
+	memcpy(record.longitude, aLongitude, sizeof(aLongitude));
+	memcpy(record.timeZone, aTimeZone, sizeof(aTimeZone));
+	record.crc = configCrc(&record);
+
+	halStoragePut(EEPROM_CONFIG, record);
+}
+
+//
+// Save calibration data to EEPROM and print C code for the default values
+// that can be used in this program. The values between 5 minute marks are
+// filled in as the marks are adjusted, see calFill().
+//
+
+void configSave() {
+	configWrite();
 
 	Serial.println();
 	Serial.println(F("// Your calibration values are:"));
 	Serial.println();
-	Serial.println(F("uint8_t HOURS_CAL[13] = {"));
+	Serial.println(F("uint16_t HOURS_CAL[13] = {"));
 	Serial.print(F("    "));
 
 	for (int val = 0; val < 13; val++) {
-		EEPROM.put(val + EEPROM_HOURS_CAL, HOURS_CAL[val]);
 		Serial.print(HOURS_CAL[val]);
 		if (val < 12)
 			Serial.print(", ");
@@ -135,13 +257,12 @@ void configSave() {
 	Serial.println();
 	Serial.println("};");
 	Serial.println();
-	Serial.println(F("int MINUTES_CAL[61] = {"));
+	Serial.println(F("uint16_t MINUTES_CAL[61] = {"));
 	Serial.print(F("    "));
 
 	for (int val = 0; val < 61; val++) {
-		EEPROM.put(EEPROM_MINUTES_CAL + val*2, MINUTES_CAL[val]);
-
-
+		if (MINUTES_CAL[val] < 10000)
+			Serial.print(" ");
 		if (MINUTES_CAL[val] < 1000)
 			Serial.print(" ");
 		if (MINUTES_CAL[val] < 100)
@@ -160,19 +281,6 @@ void configSave() {
 
 	Serial.println();
 	Serial.println("};");
-
-	EEPROM.put(EEPROM_COLOR_MODE, colorMode);
-	EEPROM.put(EEPROM_GLOB_SCALE, globScale);
-    EEPROM.put(EEPROM_GMT_OFFSET, gmtOffset);
-    EEPROM.put(EEPROM_DST_OBS, dstObs);
-    EEPROM.put(EEPROM_NEOPIXEL_R, r);
-	EEPROM.put(EEPROM_NEOPIXEL_G, g);
-	EEPROM.put(EEPROM_NEOPIXEL_B, b);
-
-	for (int addr=0; addr < MAX_LOC_LEN; addr++) {
-		EEPROM[EEPROM_LATITUDE+addr] = aLatitude[addr];
-		EEPROM[EEPROM_LONGITUDE+addr] = aLongitude[addr];
-	}
 }
 
 //
@@ -188,54 +296,10 @@ void configCreate() {
 	strncpy(aLatitude, DEFAULT_LATITUDE, MAX_LOC_LEN);
 	strncpy(aLongitude, DEFAULT_LONGITUDE, MAX_LOC_LEN);
 
-	configSave();
-}
-
-//
-//	helper routine to calculate EEPROM offsets.
-//
-
-void configPrint() {
-/*
-	int address = 0;
-
-	Serial.print(F("#define EEPROM_SENTINEL "));
-	Serial.println(address);
-	address += 3;
-
-	Serial.print(F("#define EEPROM_HOURS_CAL "));
-	Serial.println(address);
-	address += sizeof(HOURS_CAL);
-
-	Serial.print(F("#define EEPROM_MINUTES_CAL "));
-	Serial.println(address);
-	address += sizeof(MINUTES_CAL);
-
-	Serial.print(F("#define EEPROM_COLOR_MODE "));
-	Serial.println(address);
-	address += sizeof(colorMode);
-
-	Serial.print(F("#define EEPROM_GLOB_SCALE "));
-	Serial.println(address);
-	address += sizeof(globScale);
-
-    Serial.print(F("#define EEPROM_GMT_OFFSET "));
-    Serial.println(address);
-    address += sizeof(gmtOffset);
-
-    Serial.print(F("#define EEPROM_DST_OBS "));
-    Serial.println(address);
-    address += sizeof(dstObs);
-
-	Serial.print(F("#define EEPROM_LATITUDE "));
-	Serial.println(address);
-	address += MAX_LOC_LEN;
+	memset(aTimeZone, 0, MAX_TZ_LEN+1);
+	strncpy(aTimeZone, DEFAULT_TIME_ZONE, MAX_TZ_LEN);
 
-    Serial.print(F("#define EEPROM_LONGITUDE "));
-    Serial.println(address);
-    address += MAX_LOC_LEN;
-	Serial.println();
-	*/
+	configSave();
 }
 
 //
@@ -244,7 +308,6 @@ void configPrint() {
 
 void configHelp() {
 
-	configPrint();
 	Serial.println();
 	Serial.println(F("Configuration Menu"));
 	Serial.println(F("========================"));
@@ -253,12 +316,24 @@ void configHelp() {
 	Serial.println(F("'m' Minute meter adjust"));
 	Serial.println(F("'i' Increase PWM"));
 	Serial.println(F("'d' Decrease PWM"));
+	Serial.println(F("'+' Increase PWM by 1/16"));
+	Serial.println(F("'-' Decrease PWM by 1/16"));
 	Serial.println(F("'n' Next hour/minute PWM"));
 	Serial.println(F("'p' Previous hour/minute PWM"));
+	Serial.println(F("'k' Mark/unmark hour/minute for fit"));
+	Serial.println(F("'f' Fit marked hours/minutes"));
+	Serial.println(F("'x' Clear marks"));
 	Serial.println(F("'c' change colormode"));
 	Serial.println(F("'s' Sweep minutes"));
 	Serial.println(F("'t' Set time"));
 	Serial.println(F("'l' Set location"));
+	Serial.println(F("'u' Set turbidity"));
+	Serial.println(F("'a' Set sweep and glide animation"));
+	Serial.println(F("'v' Set needle ballistics"));
+	Serial.println(F("'e' Show solar events"));
+	Serial.println(F("'b' Benchmark sky colours"));
+	Serial.println(F("'r' Show RTC syncs"));
+	Serial.println(F("'o' Show output latency"));
 	Serial.println(F("'w' Write to EEPROM"));
 	Serial.println(F("'q' Quit menu"));
 	Serial.println();
@@ -280,15 +355,15 @@ void demoWheel() {
 //
 
 void demoSky() {
-	int year = theTime.year();
-	int month = theTime.month();
-	int day = theTime.day();
+	int year = theTime.year;
+	int month = theTime.month;
+	int day = theTime.day;
 
 	for (int hour = 0; hour < 24; hour++) {
-		analogWrite(HOURPWM, HOURS_CAL[hour % 13]);
+		halHourMeter(HOURS_CAL[hour % 13]);
 		for (int minute = 0; minute < 60; minute += 10) {
-			theTime = DateTime(year, month, day, hour, minute);
-            setPixelColor(sky_angle-(M_PI/2), 255);
+			clockTimeSet(&theTime, DateTime(year, month, day, hour, minute).unixtime());
+            setPixelColor(MODE_SKY, 255);
 			delay(50);
 		}
 	}
@@ -299,30 +374,31 @@ void demoSky() {
 //
 
 void demoSun() {
-	int year = theTime.year();
-	int month = theTime.month();
-	int day = theTime.day();
+	int year = theTime.year;
+	int month = theTime.month;
+	int day = theTime.day;
 
 	for (int hour = 0; hour < 24; hour++) {
-		analogWrite(HOURPWM, HOURS_CAL[hour % 13]);
+		halHourMeter(HOURS_CAL[hour % 13]);
 		for (int minute = 0; minute < 60; minute += 15) {
-			theTime = DateTime(year, month, day, hour, minute);
-			setPixelColor(sky_angle, 255);
+			clockTimeSet(&theTime, DateTime(year, month, day, hour, minute).unixtime());
+			setPixelColor(MODE_SUN, 255);
 			delay(50);
 		}
 	}
 }
 
 //
-// char getValue(char *buffer, int maxlength)
-//  Edit char string in buffer with maxLength
+// char getValue(char *buffer, int maxlength, bool text)
+//  Edit char string in buffer with maxLength, a number
+//	or with text set any printable characters
 //	Returns:
 //		ESC if escape key pressed,
 //		CR if return key pressed,
 //		0 if buffer is NULL
 //
 
-char getValue(char *buffer, int maxLength) {
+char getValue(char *buffer, int maxLength, bool text = false) {
 	char erase[4] = "\x08 \x08";
 	char c = 0;
 
@@ -366,6 +442,14 @@ char getValue(char *buffer, int maxLength) {
 							buffer[l++] = '-';
 							buffer[1] = 0;
 							Serial.print(c);
+							break;
+						}
+					// fall through - a '-' after the first is text
+					default:
+						if (text && isPrintable(c) && l < maxLength-1) {
+							buffer[l++] = c;
+							buffer[l] = 0;
+							Serial.print(c);
 						}
 					break;
 				}
@@ -435,7 +519,7 @@ void configColor(void) {
 				r = new_r;
 				g = new_g;
 				b = new_b;
-			  	setColor(pixel.Color(r, g, b));
+			  	setColor(halPixelColor(r, g, b));
 				again = false;
 			}
 			else
@@ -518,19 +602,20 @@ void configColorMode(void) {
 //
 
 void configTime(void) {
-	theTime = rtc.now();
-	int hour = theTime.hour();
-	int minute = theTime.minute();
-	int offset = gmtOffset;
-	int year = theTime.year();
-	int month = theTime.month();
-	int day = theTime.day();
-	int observed = dstObs;
+	clockTimeTo(&theTime, now());
+	int hour = theTime.hour;
+	int minute = theTime.minute;
+	int year = theTime.year;
+	int month = theTime.month;
+	int day = theTime.day;
+	char zone[MAX_TZ_LEN+1];
 	bool again = true;
 	int count = 0;
-	char ch;
+	char ch = 0;
 
-	Serial.println(theTime.timestamp());
+	strcpy(zone, aTimeZone);
+
+	Serial.println(clockTimeDate(&theTime).timestamp());
 	Serial.println(F("Enter new time or press ESC to quit."));
 	while (again) {
 
@@ -546,48 +631,40 @@ void configTime(void) {
 			break;
 
 			case 2:
-				Serial.print(F("GMT offset (-West) ? "));
-				ch = getInt(&offset);
+				Serial.print(F("Time zone (POSIX TZ) ? "));
+				ch = getValue(zone, sizeof(zone), true);
 			break;
 
 			case 3:
-				Serial.print(F("DST Observed (0-No,1-Yes) ? "));
-				ch = getInt(&observed);
-			break;
-
-			case 4:
 				Serial.print(F("4 digit year ? "));
 				ch = getInt(&year);
 			break;
 
-			case 5:
+			case 4:
 				Serial.print(F("month ? "));
 				ch = getInt(&month);
 			break;
 
-			case 6:
+			case 5:
 				Serial.print(F("day ? "));
 				ch = getInt(&day);
 			break;
 		}
 
 		if (ch == 0x0d) {
-			if (count == 6) {
-				DateTime newTime = DateTime(year, month, day, hour, minute);
-
-				if (dstObs) {	// if DST observed
-					if (isDST(newTime.day(), newTime.month(), newTime.dayOfTheWeek())) {
-						if (newTime.hour() >= 2) {
-							newTime = newTime - TimeSpan(0, 1, 0, 0);
-							dstActive = 1;
-						}
-					}
-				}
+			if (count == 2 && !tzSet(zone)) {
+				Serial.println(F("Not a TZ string, e.g. PST8PDT,M3.2.0,M11.1.0"));
+				continue;
+			}
 
-				rtc.adjust(newTime);
-				Serial.println(now().timestamp());
-				gmtOffset = offset;
-			    dstObs = observed;
+			if (count == 5) {
+				strcpy(aTimeZone, zone);
+
+				// the RTC keeps standard time
+				uint32_t local = DateTime(year, month, day, hour, minute).unixtime();
+
+				softClockAdjust(DateTime(tzStandard(local)));
+				Serial.println(DateTime(now()).timestamp());
 				again = false;
 			}
 			else
@@ -595,6 +672,7 @@ void configTime(void) {
 		}
 
 		if (ch == 0x1b) {
+			tzSet(aTimeZone);
 			again = false;
 		}
 	}
@@ -609,7 +687,7 @@ void configLocation(void) {
 	int count = 0;
 	char ch;
 
-	Serial.println(theTime.timestamp());
+	Serial.println(clockTimeDate(&theTime).timestamp());
 	Serial.println(F("Enter new location or press ESC to quit."));
 	while (again) {
 		switch (count) {
@@ -640,6 +718,288 @@ void configLocation(void) {
 	}
 }
 
+//
+// set the turbidity, 0 for the seasonal curve
+//
+
+void configTurbidity(void) {
+	char buffer[5];
+	char ch;
+
+	if (turbiditySetting == TURBIDITY_SEASONAL)
+		strcpy(buffer, "0");
+	else
+		dtostrf(turbiditySetting/10.0, 3, 1, buffer);
+
+	Serial.println(F("Enter new turbidity or press ESC to quit."));
+
+	do {
+		Serial.print(F("Turbidity (1.8-4.0, 0 for seasonal)? "));
+		ch = getValue(buffer, sizeof(buffer));
+
+		if (ch == 0x0d) {
+			int value = atof(buffer)*10+0.5;
+
+			if (value == TURBIDITY_SEASONAL || (value >= TURBIDITY_MIN && value <= TURBIDITY_MAX)) {
+				turbiditySetting = value;
+				turbidity = calcTurbidity(theTime.month, theTime.day);
+				Serial.print(F("Turbidity today: "));
+				Serial.println(turbidity, 1);
+				return;
+			}
+		}
+	} while (ch != 0x1b);
+}
+
+//
+// set how the meters sweep back and glide, then show the sweep
+// on the minute meter
+//
+
+void configSweep(void) {
+	int time = sweepTime;
+	int easing = sweepEasing;
+	int glides = glide;
+	bool again = true;
+	int count = 0;
+	char ch;
+
+	Serial.println(F("Enter new sweep or press ESC to quit."));
+	while (again) {
+		switch (count) {
+			case 0:
+				Serial.print(F("Sweep time in tenths of a second (0-50) ? "));
+				ch = getInt(&time);
+			break;
+
+			case 1:
+				Serial.print(F("Easing (0-Linear,1-Ease out,2-Damped) ? "));
+				ch = getInt(&easing);
+			break;
+
+			case 2:
+				Serial.print(F("Glide (0-None,1-Hour,2-Minute,3-Both) ? "));
+				ch = getInt(&glides);
+			break;
+		}
+
+		if (ch == 0x0d) {
+			if (count == 0 && (time < 0 || time > SWEEP_TIME_MAX))
+				continue;
+
+			if (count == 1 && (easing < 0 || easing >= EASE_COUNT))
+				continue;
+
+			if (count == 2) {
+				if (glides < 0 || glides > GLIDE_MAX)
+					continue;
+
+				sweepTime = time;
+				sweepEasing = easing;
+				glide = glides;
+
+				needleMove(NEEDLE_MINUTE, NEEDLE_POSITION(60), 0, sweepEasing);
+				delay(500);
+				needleMove(NEEDLE_MINUTE, NEEDLE_POSITION(0), sweepTime*100, sweepEasing);
+				while (needleUpdate())
+					delay(NEEDLE_STEP);
+
+				again = false;
+			}
+			else
+				count++;
+		}
+
+		if (ch == 0x1b) {
+			again = false;
+		}
+	}
+}
+
+//
+// set the meters' ballistics and the shaper, then show a
+// step on the minute meter
+//
+
+void configBallistics(void) {
+	int shape = shaper;
+	int values[4] = {meterFrequency[NEEDLE_HOUR], meterDamping[NEEDLE_HOUR],
+		meterFrequency[NEEDLE_MINUTE], meterDamping[NEEDLE_MINUTE]};
+	int count = 0;
+	char ch = 0;
+
+	Serial.println(F("Enter new ballistics or press ESC to quit."));
+	while (true) {
+		switch (count) {
+			case 0:
+				Serial.print(F("Shaper (0-None,1-ZV,2-ZVD) ? "));
+				ch = getInt(&shape);
+			break;
+
+			case 1:
+			case 3:
+				Serial.print(count == 1 ? F("Hour") : F("Minute"));
+				Serial.print(F(" meter frequency in tenths of a Hz (5-50) ? "));
+				ch = getInt(&values[count-1]);
+			break;
+
+			case 2:
+			case 4:
+				Serial.print(count == 2 ? F("Hour") : F("Minute"));
+				Serial.print(F(" meter damping in hundredths (0-90) ? "));
+				ch = getInt(&values[count-1]);
+			break;
+		}
+
+		if (ch == 0x1b)
+			return;
+
+		if (ch != 0x0d)
+			continue;
+
+		if (count == 0 && (shape < 0 || shape >= SHAPE_COUNT))
+			continue;
+
+		if ((count == 1 || count == 3) &&
+			(values[count-1] < FREQUENCY_MIN || values[count-1] > FREQUENCY_MAX))
+			continue;
+
+		if ((count == 2 || count == 4) && (values[count-1] < 0 || values[count-1] > DAMPING_MAX))
+			continue;
+
+		if (count++ < 4)
+			continue;
+
+		shaper = shape;
+		meterFrequency[NEEDLE_HOUR] = values[0];
+		meterDamping[NEEDLE_HOUR] = values[1];
+		meterFrequency[NEEDLE_MINUTE] = values[2];
+		meterDamping[NEEDLE_MINUTE] = values[3];
+		needleShape();
+
+		needleMove(NEEDLE_MINUTE, NEEDLE_POSITION(0), 0, EASE_LINEAR);
+		while (needleUpdate())
+			delay(NEEDLE_STEP);
+		delay(1000);
+
+		needleMove(NEEDLE_MINUTE, NEEDLE_POSITION(30), 0, EASE_LINEAR);
+		while (needleUpdate())
+			delay(NEEDLE_STEP);
+		delay(1000);
+		return;
+	}
+}
+
+//
+// print an event time as HH:MM
+//
+
+void printEvent(const __FlashStringHelper *name, float time) {
+	int hour;
+	int minute;
+	char buffer[6];
+
+	decToHourMinute(time, &hour, &minute);
+	sprintf(buffer, "%02d:%02d", hour, minute);
+	Serial.print(name);
+	Serial.println(buffer);
+}
+
+//
+// show today's solar events and how many sky colour
+// evaluations the lit window saved
+//
+
+void configEvents(void) {
+	printEvent(F("Nautical dawn: "), events.nauticalDawn);
+	printEvent(F("Civil dawn:    "), events.civilDawn);
+	printEvent(F("Sunrise:       "), events.sunrise);
+	printEvent(F("Sunset:        "), events.sunset);
+	printEvent(F("Civil dusk:    "), events.civilDusk);
+	printEvent(F("Nautical dusk: "), events.nauticalDusk);
+
+	Serial.print(F("Colour evaluations today: "));
+	Serial.print(colorEvals);
+	Serial.print(F(" skipped: "));
+	Serial.println(colorSkips);
+	Serial.print(F("Colour evaluations yesterday: "));
+	Serial.print(lastColorEvals);
+	Serial.print(F(" skipped: "));
+	Serial.println(lastColorSkips);
+}
+
+//
+// show how often the soft clock has read and written
+// the RTC and how far it had drifted
+//
+
+void configSync(void) {
+	Serial.print(F("RTC reads: "));
+	Serial.print(softClockStats.reads);
+	Serial.print(F(" writes: "));
+	Serial.println(softClockStats.writes);
+	Serial.print(F("Corrections: "));
+	Serial.print(softClockStats.corrections);
+	Serial.print(F(" largest: "));
+	Serial.print(softClockStats.maxCorrection);
+	Serial.println(F(" s"));
+}
+
+//
+// show how many ticks the outputs went out on the edge and
+// how many the loop put out late, and how late
+//
+
+void configLatency(void) {
+	Serial.print(F("On the edge: "));
+	Serial.print(framesOnEdge);
+	Serial.print(F(" last: "));
+	Serial.print(halFrameLatency());
+	Serial.println(F(" us"));
+	Serial.print(F("Late: "));
+	Serial.print(framesLate);
+	Serial.print(F(" last: "));
+	Serial.print(lateMicros);
+	Serial.print(F(" us longest: "));
+	Serial.print(maxLateMicros);
+	Serial.println(F(" us"));
+}
+
+//
+// fit the meter to its marked points and show how closely
+// the fit passes through them
+//
+
+void configFit(uint8_t meter) {
+	int order = CAL_LINEAR;
+	CalFit fit;
+	char ch;
+
+	Serial.println(F("Enter fit order or press ESC to quit."));
+
+	do {
+		Serial.print(F("Order (1-Linear,2-Quadratic,3-Cubic) ? "));
+		ch = getInt(&order);
+
+		if (ch == 0x0d && order >= CAL_LINEAR && order <= CAL_CUBIC) {
+			if (!calFit(meter, order, &fit)) {
+				Serial.println(F("Mark two or more points first"));
+				return;
+			}
+
+			Serial.print(F("Points: "));
+			Serial.print(fit.points);
+			Serial.print(F(" order: "));
+			Serial.println(fit.order);
+			Serial.print(F("Residual rms: "));
+			Serial.print(fit.rms, 3);
+			Serial.print(F(" max: "));
+			Serial.println(fit.worst, 3);
+			return;
+		}
+	} while (ch != 0x1b);
+}
+
 //
 // configure menu
 //
@@ -653,6 +1013,7 @@ void configMenu() {
 	uint8_t minute = 0;
 	uint8_t hour_pwm = 0;
 	uint8_t minute_pwm = 0;
+	uint16_t step;
 
 	configHelp();
 
@@ -682,19 +1043,29 @@ void configMenu() {
 				break;
 
 				case 'i':
+				case '+':
+					step = ch == '+' ? 1 : 1 << METER_FRACTION_BITS;
+
 					if (adjust == hours)
-						HOURS_CAL[hour]++;
+						HOURS_CAL[hour] += step;
 
-					if (adjust == minutes)
-						MINUTES_CAL[minute]++;
+					if (adjust == minutes) {
+						MINUTES_CAL[minute] += step;
+						calFill(minute);
+					}
 				break;
 
 				case 'd':
+				case '-':
+					step = ch == '-' ? 1 : 1 << METER_FRACTION_BITS;
+
 					if (adjust == hours)
-						HOURS_CAL[hour]--;
+						HOURS_CAL[hour] -= step;
 
-					if (adjust == minutes)
-						MINUTES_CAL[minute]--;
+					if (adjust == minutes) {
+						MINUTES_CAL[minute] -= step;
+						calFill(minute);
+					}
 				break;
 
 				case 'n':
@@ -721,6 +1092,22 @@ void configMenu() {
 					}
 				break;
 
+				case 'k':
+					if (adjust == hours)
+						calMark(NEEDLE_HOUR, hour, !calMarked(NEEDLE_HOUR, hour));
+
+					if (adjust == minutes)
+						calMark(NEEDLE_MINUTE, minute, !calMarked(NEEDLE_MINUTE, minute));
+				break;
+
+				case 'f':
+					configFit(adjust == hours ? NEEDLE_HOUR : NEEDLE_MINUTE);
+				break;
+
+				case 'x':
+					calClear(adjust == hours ? NEEDLE_HOUR : NEEDLE_MINUTE);
+				break;
+
 				case 'c':
                     configColorMode();
 				break;
@@ -730,7 +1117,7 @@ void configMenu() {
 						Serial.print(F("Minute: "));
 						Serial.print(val);
 						Serial.print(F("pwm: "));
-						Serial.println(MINUTES_CAL[val]);
+						Serial.println(MINUTES_CAL[val]/16.0, 4);
 						updateMinute(MINUTES_CAL[val]);
 						delay(500);
 					}
@@ -744,6 +1131,34 @@ void configMenu() {
 					configLocation();
 				break;
 
+				case 'u':
+					configTurbidity();
+				break;
+
+				case 'a':
+					configSweep();
+				break;
+
+				case 'v':
+					configBallistics();
+				break;
+
+				case 'e':
+					configEvents();
+				break;
+
+				case 'b':
+					benchSky();
+				break;
+
+				case 'r':
+					configSync();
+				break;
+
+				case 'o':
+					configLatency();
+				break;
+
 				case 'w':
 					configSave();
 				break;
@@ -761,18 +1176,25 @@ void configMenu() {
 					Serial.print(F("Adjusting hour: "));
 					Serial.print(hour);
 					Serial.print(F(" pwm: "));
-					Serial.println(HOURS_CAL[hour]);
+					Serial.print(HOURS_CAL[hour]/16.0, 4);
+					if (calMarked(NEEDLE_HOUR, hour))
+						Serial.print(F(" marked"));
+					Serial.println();
 				}
 
 				if (adjust == minutes) {
 					Serial.print(F("Adjusting Minute: "));
 					Serial.print(minute);
 					Serial.print(F(" pwm: "));
-					Serial.println(MINUTES_CAL[minute]);
+					Serial.print(MINUTES_CAL[minute]/16.0, 4);
+					if (calMarked(NEEDLE_MINUTE, minute))
+						Serial.print(F(" marked"));
+					Serial.println();
 				}
 
-				analogWrite(HOURPWM, HOURS_CAL[hour]);
+				halHourMeter(HOURS_CAL[hour]);
 				updateMinute(MINUTES_CAL[minute]);
+				needleFit();
 				Serial.print(">");
 			}
 		}
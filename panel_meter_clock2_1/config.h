@@ -9,6 +9,8 @@
 #ifndef __CONFIG_H__
 #define __CONFIG_H__
 
+#include "clocktime.h"
+
 // define pins usage
 
 #define HOURPWM 5
@@ -16,22 +18,34 @@
 #define HOURADJ 8
 #define MINADJ 11
 #define NEOPIXEL 10
+#define SQWINT 7		// DS3231 SQW, wakes the clock each second
+
+// number of NeoPixels, the sun and sky modes draw a gradient on more than one
+
+#ifndef NEOPIXEL_COUNT
+#define NEOPIXEL_COUNT 1
+#endif
+
+// EEPROM settings record, see configLoad()
+
+#define EEPROM_CONFIG 256
+#define CONFIG_VERSION 1
 
-// EEPROM config value offsets
+// and the offsets of the fields before it, version 0, read only to
+// carry the settings forward
 
 #define EEPROM_SENTINEL 0
-#define EEPROM_HOURS_CAL 3
+#define EEPROM_HOURS_CAL 3		// 8 bit, before the 10 bit hour meter
 #define EEPROM_MINUTES_CAL 16
 #define EEPROM_COLOR_MODE 138
 #define EEPROM_GLOB_SCALE 139
-#define EEPROM_GMT_OFFSET 140
+#define EEPROM_GMT_OFFSET 140	// before the time zone, see configMigrate()
 #define EEPROM_DST_OBS 141
 #define EEPROM_NEOPIXEL_R 142
 #define EEPROM_NEOPIXEL_G 143
 #define EEPROM_NEOPIXEL_B 144
 #define EEPROM_LATITUDE 145
 #define EEPROM_LONGITUDE 155
-#define EEPROM_AVAIL 165
 
 // colorModes
 
@@ -41,59 +55,140 @@
 #define MODE_SKY 3
 #define MODE_SUN 4
 
+// turbidity in tenths, the Perez model holds together from 1.8 to 4.0.
+// TURBIDITY_SEASONAL follows the monthly curve in TURBIDITY_MONTHLY.
+
+#define TURBIDITY_SEASONAL 0
+#define TURBIDITY_MIN 18
+#define TURBIDITY_MAX 40
+
+// sweep back of the meters in tenths of a second and its easing, one
+// of the EASE_ curves in needle.h
+
+#define SWEEP_TIME_MAX 50
+
+// needles that glide between the whole hours and minutes, the hour with
+// the minutes and the minute with the seconds
+
+#define GLIDE_HOUR 0x01
+#define GLIDE_MINUTE 0x02
+#define GLIDE_MAX 0x03
+
+// the meters' ballistics, their natural frequency in tenths of a Hz and
+// damping ratio in hundredths, and the shaper, one of the SHAPE_ in
+// needle.h, that the moves go through so they don't set them ringing
+
+#define FREQUENCY_MIN 5
+#define FREQUENCY_MAX 50
+#define DAMPING_MAX 90
+
 //
 // BEGIN DEFAULT CONFIG VALUES
 //
 
 #define DEFAULT_COLOR_MODE MODE_WHEEL
-#define DEFAULT_GMT_OFFSET -8
-#define DEFAULT_DST_OBSERVED 1
+#define DEFAULT_TIME_ZONE "PST8PDT,M3.2.0,M11.1.0"
 #define DEFAULT_LATITUDE "46.2087"
 #define DEFAULT_LONGITUDE "-119.1199"
 #define DEFAULT_R 32
 #define DEFAULT_G 0
 #define DEFAULT_B 0
+#define DEFAULT_TURBIDITY 18
+#define DEFAULT_SWEEP_TIME 10
+#define DEFAULT_SWEEP_EASING 0	// EASE_LINEAR
+#define DEFAULT_GLIDE GLIDE_HOUR
+#define DEFAULT_SHAPER 2		// SHAPE_ZVD
+#define DEFAULT_FREQUENCY 15	// 1.5 Hz
+#define DEFAULT_DAMPING 30		// 0.3
 
 //
 // END DEFAULT CONFIG VALUES
 //
 
 #define MAX_LOC_LEN 10
+#define MAX_TZ_LEN 40
+
+//
+// The settings are kept in EEPROM as one record, read and written in a
+// block and checked by a CRC16 over the rest of it. A record that fails
+// the check, or is of another version, is put back to the defaults.
+// CONFIG_VERSION goes up with the record's layout. Version 0 is the
+// layout from before the record, a field at each EEPROM_ offset. It is
+// read once to carry the settings forward and otherwise left alone.
+//
+
+struct ConfigRecord {
+	char sentinel[3];				// "PMC"
+	uint8_t version;
+	uint16_t hoursCal[13];			// in 1/16ths, see METER_FRACTION_BITS
+	uint16_t minutesCal[61];
+	uint8_t colorMode;
+	uint8_t globScale;
+	uint8_t r, g, b;
+	uint8_t turbidity;
+	uint8_t sweepTime;
+	uint8_t sweepEasing;
+	uint8_t glide;
+	uint8_t shaper;
+	uint8_t frequency[2];
+	uint8_t damping[2];
+	char latitude[MAX_LOC_LEN+1];
+	char longitude[MAX_LOC_LEN+1];
+	char timeZone[MAX_TZ_LEN+1];
+	uint16_t crc;					// of everything before it
+} __attribute__((packed));
 
 extern char aLatitude[MAX_LOC_LEN+1];
 extern char aLongitude[MAX_LOC_LEN+1];
+extern char aTimeZone[MAX_TZ_LEN+1];
 
-extern uint8_t HOURS_CAL[13];
+extern uint16_t HOURS_CAL[13];
 extern uint16_t MINUTES_CAL[61];
 extern uint8_t colorMode;
 extern uint8_t globScale;
-extern int8_t gmtOffset;
-extern uint8_t dstObs;
+extern int16_t utcOffset;
 extern float longitude;
 extern float latitude;
+extern uint8_t turbiditySetting;
+extern uint8_t sweepTime;
+extern uint8_t sweepEasing;
+extern uint8_t glide;
+extern uint8_t shaper;
+extern uint8_t meterFrequency[2];
+extern uint8_t meterDamping[2];
+extern float turbidity;
 
-extern int dstActive;
 extern int lastDay;
 extern int lastHour;
 extern int lastMinute;
+extern int lastSecond;
 extern int colorStep;
 extern uint8_t r, g, b;
 
-extern float sky_angle;
-extern DateTime theTime;
+extern long colorEvals;
+extern long colorSkips;
+extern long lastColorEvals;
+extern long lastColorSkips;
 
-extern Adafruit_NeoPixel pixel;
-extern RTC_DS3231 rtc;
+extern unsigned long framesOnEdge;
+extern unsigned long framesLate;
+extern unsigned long lateMicros;
+extern unsigned long maxLateMicros;
+
+extern float sky_angle;
+extern ClockTime theTime;
 
 void configCreate();
 void configLoad();
+void configWrite();
 void configMenu();
 
-extern int isDST(int day, int month, int dow);
-extern DateTime now(void);
+extern uint32_t now(void);
 
 extern void setColor(uint32_t color);
 extern uint32_t Wheel(byte WheelPos);
-extern void setPixelColor(float sky_angle, uint8_t glob_scale);
+extern void setPixelColor(uint8_t mode, uint8_t glob_scale);
+extern void benchSky();
+extern float calcTurbidity(int month, int day);
 
 #endif
@@ -0,0 +1,49 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#include "hal.h"
+#include <math.h>
+#include <stdint.h>
+
+#include "fastmath.h"
+#include "gammatable.h"
+
+float fast_tan(float x) {
+    return fast_sin(x)/fast_cos(x);
+}
+
+//
+// Abramowitz and Stegun 4.4.46
+//
+
+float fast_acos(float x) {
+    float a = fabs(x);
+    float p = 1.5707963050f+a*(-0.2145988016f+a*(0.0889789874f+a*(-0.0501743046f+\
+        a*(0.0308918810f+a*(-0.0170881256f+a*(0.0066700901f+a*-0.0012624911f))))));
+
+    p *= sqrt(1-a);
+
+    if (x < 0)
+        return M_PI-p;
+
+    return p;
+}
+
+float fast_gamma(float x) {
+    if (x <= 0)
+        return 0;
+
+    if (x >= 1)
+        return 1;
+
+    float pos = x*GAMMA_TABLE_STEPS;
+    uint16_t idx = pos;
+    float first = pgm_read_word(&GAMMA_TABLE_DATA[idx]);
+    float next = pgm_read_word(&GAMMA_TABLE_DATA[idx+1]);
+
+    return (first+(next-first)*(pos-idx))*(1.0f/65535);
+}
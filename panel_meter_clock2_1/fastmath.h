@@ -0,0 +1,126 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Fast float approximations for the sky colour maths.
+//
+// The libm routines are correct to the last bit, which costs several
+// thousand cycles each in soft float. These trade that for short
+// polynomials and a table, well inside the 1/255 steps of a NeoPixel.
+// The worst errors given were measured over the inputs the clock uses,
+// tests/fastmath_test.cpp checks them.
+//
+
+#ifndef __FASTMATH_H__
+#define __FASTMATH_H__
+
+#include <math.h>
+#include <stdint.h>
+
+//
+// Set FAST_MATH to 1 to use these in the Perez model and the gamma
+// correction, or 0 for libm.
+//
+
+#ifndef FAST_MATH
+#define FAST_MATH 1
+#endif
+
+// tan(x), relative error 2.6e-7 for |x| < 0.3, the range calc_Yz() uses,
+// growing towards 1.3e-4 close to the poles
+extern float fast_tan(float x);
+
+// acos(x), absolute error 3.3e-7 radians for -1 <= x <= 1
+extern float fast_acos(float x);
+
+// x^(1/1.8) from a 256 step table, clamped to 0-1. Absolute error
+// 0.004 RGB888 steps above x = 0.1 and 2.5 steps in the first 1/256
+// where the curve is steepest.
+extern float fast_gamma(float x);
+
+//
+// exp(), sin() and cos() are inline and branch free so that the batch
+// loop in colourcalc.cpp still vectorises on the host
+//
+
+// pi and ln2 split in two so the range reductions stay exact for small k
+
+#define PI_HI 3.140625f
+#define PI_LO 9.67653589793e-4f
+#define PI_INV 0.318309886f
+
+#define LN2_HI 0.693359375f
+#define LN2_LO -2.12194440e-4f
+#define LN2_INV 1.44269504f
+
+//
+// round to the nearest integer, cheaper than floor()
+//
+
+static inline int nearest(float x) {
+    return (int)(x < 0 ? x-0.5f : x+0.5f);
+}
+
+//
+// Taylor series for sin on [-pi/2, pi/2], error 6e-8
+//
+
+static inline float sinPoly(float y) {
+    float y2 = y*y;
+
+    return y+y*y2*(-1.0f/6+y2*(1.0f/120+y2*(-1.0f/5040+y2*(1.0f/362880+y2*(-1.0f/39916800)))));
+}
+
+//
+// exp(x), relative error 2.6e-7 for -87 < x < 88, 0 below. The ends
+// are selected rather than returned early so the compiler can vectorise it.
+//
+
+static inline float fast_exp(float x) {
+    float xc = x < -87.0f ? -87.0f : (x > 88.0f ? 88.0f : x);
+
+    // x = k*ln2+r with |r| <= ln2/2, exp(x) = 2^k*exp(r)
+    int k = nearest(xc*LN2_INV);
+    float r = (xc-k*LN2_HI)-k*LN2_LO;
+
+    float p = 1+r*(1+r*(0.5f+r*(1.0f/6+r*(1.0f/24+r*(1.0f/120+r*(1.0f/720))))));
+
+    // 2^k straight into the exponent bits, k is -126 to 127 here
+    union {
+        uint32_t bits;
+        float value;
+    } scale;
+
+    scale.bits = (uint32_t)(k+127) << 23;
+    p *= scale.value;
+
+    return x < -87.0f ? 0 : (x > 88.0f ? INFINITY : p);
+}
+
+//
+// sin(x) and cos(x), absolute error 1.8e-7 for |x| < 100. Both reduce
+// to [-pi/2, pi/2] about a multiple of pi, cos about an odd multiple
+// of pi/2, and only the sign depends on which one.
+//
+
+static inline float fast_sin(float x) {
+    int k = nearest(x*PI_INV);
+    float y = (x-k*PI_HI)-k*PI_LO;
+    float s = sinPoly(y);
+
+    return (k & 1) ? -s : s;
+}
+
+static inline float fast_cos(float x) {
+    int k = nearest(x*PI_INV-0.5f);
+    float y = (x-(k+0.5f)*PI_HI)-(k+0.5f)*PI_LO;
+    float s = sinPoly(y);
+
+    return (k & 1) ? s : -s;
+}
+
+#endif
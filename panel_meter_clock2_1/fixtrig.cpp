@@ -0,0 +1,121 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#include "hal.h"
+#include <stdint.h>
+
+#include "fixtrig.h"
+
+//
+// quarter wave sine table in Q15, 128 steps from 0 to 90 degrees
+//
+
+static const int16_t SINE_TABLE[129] PROGMEM = {
+        0,   402,   804,  1206,  1608,  2009,  2410,  2811,  3212,  3612,
+     4011,  4410,  4808,  5205,  5602,  5998,  6393,  6786,  7179,  7571,
+     7962,  8351,  8739,  9126,  9512,  9896, 10278, 10659, 11039, 11417,
+    11793, 12167, 12539, 12910, 13279, 13645, 14010, 14372, 14732, 15090,
+    15446, 15800, 16151, 16499, 16846, 17189, 17530, 17869, 18204, 18537,
+    18868, 19195, 19519, 19841, 20159, 20475, 20787, 21096, 21403, 21705,
+    22005, 22301, 22594, 22884, 23170, 23452, 23731, 24007, 24279, 24547,
+    24811, 25072, 25329, 25582, 25832, 26077, 26319, 26556, 26790, 27019,
+    27245, 27466, 27683, 27896, 28105, 28310, 28510, 28706, 28898, 29085,
+    29268, 29447, 29621, 29791, 29956, 30117, 30273, 30424, 30571, 30714,
+    30852, 30985, 31113, 31237, 31356, 31470, 31580, 31685, 31785, 31880,
+    31971, 32057, 32137, 32213, 32285, 32351, 32412, 32469, 32521, 32567,
+    32609, 32646, 32678, 32705, 32728, 32745, 32757, 32765, 32767
+};
+
+//
+// sine of a binary angle in Q15, linear interpolation between table
+// entries keeps the error within 1.5 LSB
+//
+
+int16_t isin(uint16_t angle) {
+    uint16_t a = angle & 0x3FFF;
+
+    if (angle & 0x4000)
+        a = 0x4000 - a;
+
+    uint8_t idx = a >> 7;
+    uint8_t frac = a & 0x7F;
+    int16_t value = pgm_read_word(&SINE_TABLE[idx]);
+
+    if (frac) {
+        int16_t next = pgm_read_word(&SINE_TABLE[idx+1]);
+        value += ((int32_t)(next-value)*frac+64) >> 7;
+    }
+
+    return (angle & 0x8000) ? -value : value;
+}
+
+//
+// cosine of a binary angle in Q15
+//
+
+int16_t icos(uint16_t angle) {
+    return isin(angle + BAM_90);
+}
+
+//
+// arc cosine of a Q30 value as a binary angle from 0 to 32768 (180 degrees)
+//
+// Uses acos(x) = sqrt(1-x)*(a0+a1*x+a2*x^2+a3*x^3) from Abramowitz and
+// Stegun 4.4.45, which is good to 5e-5 radians over 0 <= x <= 1. With
+// Q16 coefficients the result is within 0.012 degrees.
+//
+
+uint16_t iacos(int32_t x) {
+    bool negative = x < 0;
+
+    if (negative)
+        x = -x;
+    if (x > Q30_ONE)
+        x = Q30_ONE;
+
+    int32_t xq = x >> 15;
+    int32_t poly = ((((-1227L*xq) >> 15)+4867)*xq) >> 15;
+    poly = (((poly-13901)*xq) >> 15)+102939;
+
+    // radians in Q16 times 65536/(2*pi) gives the binary angle
+    uint32_t rad = ((uint32_t)poly*isqrt32(Q30_ONE-x)) >> 15;
+    uint16_t angle = (rad*20861UL) >> 17;
+
+    return negative ? BAM_180-angle : angle;
+}
+
+//
+// arc sine of a Q30 value as a signed binary angle from -90 to 90 degrees
+//
+
+int16_t iasin(int32_t x) {
+    return BAM_90-(int32_t)iacos(x);
+}
+
+//
+// integer square root, rounded down
+//
+
+uint16_t isqrt32(uint32_t x) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > x)
+        bit >>= 2;
+
+    while (bit) {
+        if (x >= root+bit) {
+            x -= root+bit;
+            root = (root >> 1)+bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
@@ -0,0 +1,32 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Fixed point trig for the integer solar kernel.
+//
+// Angles are binary angles with 65536 to the full circle, so they wrap
+// for free in 16 bit arithmetic. Sines and cosines are Q15, the inverse
+// functions take a Q30 argument so that angles near 0 and 180 degrees
+// keep their precision.
+//
+
+#ifndef __FIXTRIG_H__
+#define __FIXTRIG_H__
+
+#include <stdint.h>
+
+#define BAM_90 16384
+#define BAM_180 32768U
+#define Q30_ONE (1L<<30)
+
+extern int16_t isin(uint16_t angle);
+extern int16_t icos(uint16_t angle);
+extern uint16_t iacos(int32_t x);
+extern int16_t iasin(int32_t x);
+extern uint16_t isqrt32(uint32_t x);
+
+#endif
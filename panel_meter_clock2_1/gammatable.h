@@ -0,0 +1,46 @@
+//
+// Generated by tools/gammatable.py, do not edit.
+//
+// x^(1/1.8) at 256 steps from 0 to 1 scaled to 65535, 514 bytes of flash.
+//
+// Worst case error against pow() in RGB888 steps:
+//     2.4966 below 0.1, 0.0037 above.
+//
+
+#define GAMMA_TABLE_STEPS 256
+
+static const uint16_t GAMMA_TABLE_DATA[257] PROGMEM = {
+        0,  3010,  4424,  5542,  6502,  7360,  8145,  8873,
+     9556, 10202, 10817, 11405, 11970, 12515, 13041, 13550,
+    14045, 14526, 14995, 15452, 15899, 16335, 16763, 17182,
+    17593, 17997, 18393, 18783, 19166, 19544, 19915, 20281,
+    20642, 20998, 21349, 21696, 22038, 22376, 22710, 23040,
+    23367, 23689, 24009, 24325, 24637, 24947, 25253, 25557,
+    25857, 26155, 26451, 26743, 27033, 27321, 27606, 27889,
+    28169, 28448, 28724, 28998, 29270, 29540, 29808, 30074,
+    30339, 30601, 30862, 31121, 31378, 31633, 31887, 32139,
+    32390, 32639, 32887, 33133, 33378, 33621, 33863, 34104,
+    34343, 34581, 34817, 35052, 35286, 35519, 35751, 35981,
+    36210, 36438, 36665, 36891, 37116, 37339, 37562, 37783,
+    38004, 38223, 38441, 38659, 38875, 39091, 39305, 39519,
+    39732, 39943, 40154, 40364, 40573, 40782, 40989, 41196,
+    41402, 41607, 41811, 42014, 42217, 42418, 42619, 42820,
+    43019, 43218, 43416, 43613, 43810, 44006, 44201, 44396,
+    44590, 44783, 44975, 45167, 45359, 45549, 45739, 45928,
+    46117, 46305, 46493, 46679, 46866, 47051, 47237, 47421,
+    47605, 47788, 47971, 48153, 48335, 48516, 48697, 48877,
+    49057, 49236, 49414, 49592, 49770, 49947, 50123, 50299,
+    50475, 50650, 50824, 50998, 51172, 51345, 51518, 51690,
+    51862, 52033, 52204, 52374, 52544, 52713, 52882, 53051,
+    53219, 53387, 53554, 53721, 53888, 54054, 54220, 54385,
+    54550, 54714, 54879, 55042, 55206, 55369, 55531, 55693,
+    55855, 56017, 56178, 56338, 56499, 56659, 56818, 56977,
+    57136, 57295, 57453, 57611, 57768, 57926, 58082, 58239,
+    58395, 58551, 58706, 58861, 59016, 59171, 59325, 59479,
+    59632, 59785, 59938, 60091, 60243, 60395, 60547, 60698,
+    60849, 61000, 61151, 61301, 61451, 61600, 61749, 61898,
+    62047, 62196, 62344, 62492, 62639, 62787, 62934, 63080,
+    63227, 63373, 63519, 63665, 63810, 63955, 64100, 64245,
+    64389, 64533, 64677, 64821, 64964, 65107, 65250, 65393,
+    65535
+};
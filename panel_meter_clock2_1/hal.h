@@ -0,0 +1,147 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Hardware abstraction for the clock.
+//
+// The sketch reaches the RTC, the meters, the NeoPixels, the EEPROM and
+// the adjust buttons only through these calls. hal_avr.cpp drives the
+// clock's board, hal_linux.cpp simulates it so the same setup() and
+// loop() build with g++ and run on a desktop. The console is Serial on
+// both, the USB serial port or stdin and stdout.
+//
+
+#ifndef __HAL_H__
+#define __HAL_H__
+
+//
+// Set HAL_LINUX to 1 to build for the Linux simulation, the Arduino IDE
+// leaves it 0.
+//
+
+#ifndef HAL_LINUX
+#define HAL_LINUX 0
+#endif
+
+#if HAL_LINUX
+#include "hal_linux.h"
+#else
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+#include <RTClib.h>
+#endif
+
+#include <stdint.h>
+
+// clock source, local standard time
+
+extern bool halClockBegin();
+extern bool halClockLostPower();
+extern DateTime halClockNow();
+extern void halClockAdjust(const DateTime &time);
+
+// meter outputs, both on 10 bit PWM with the values in 1/16ths of a
+// count. With METER_DITHER set each period's count is picked by a first
+// order sigma-delta so over 16 periods they average out to the value,
+// otherwise it is rounded to the nearest count.
+
+#ifndef METER_DITHER
+#define METER_DITHER 1
+#endif
+
+#define METER_FRACTION_BITS 4
+#define METER_FRACTION ((1 << METER_FRACTION_BITS)-1)
+
+extern void halMeterBegin();
+extern void halHourMeter(uint16_t value);
+extern void halMinuteMeter(uint16_t value);
+
+struct HalDither {
+    uint16_t value;
+    uint8_t error;          // fraction carried from the last period
+};
+
+static inline uint16_t halDitherNext(HalDither *dither) {
+    uint8_t sum = dither->error+(dither->value & METER_FRACTION);
+
+    dither->error = sum & METER_FRACTION;
+    return (dither->value >> METER_FRACTION_BITS)+(sum >> METER_FRACTION_BITS);
+}
+
+// pixel output, colours packed as 0x00RRGGBB
+
+extern void halPixelBegin();
+extern void halPixelSet(uint16_t n, uint32_t color);
+extern void halPixelFill(uint32_t color);
+extern void halPixelShow();
+
+static inline uint32_t halPixelColor(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16)|((uint32_t)g << 8)|b;
+}
+
+// persistent storage, writes of an unchanged byte are skipped. A value
+// is read or written as a block.
+
+extern uint8_t halStorageRead(int address);
+extern void halStorageWrite(int address, uint8_t value);
+extern void halStorageReadBlock(int address, void *data, uint16_t size);
+extern void halStorageWriteBlock(int address, const void *data, uint16_t size);
+
+template <typename T> T &halStorageGet(int address, T &value) {
+    halStorageReadBlock(address, &value, sizeof(T));
+    return value;
+}
+
+template <typename T> const T &halStoragePut(int address, const T &value) {
+    halStorageWriteBlock(address, &value, sizeof(T));
+    return value;
+}
+
+// buttons, true while the hour or minute adjust button is held
+
+extern void halButtonBegin();
+extern bool halHourButton();
+extern bool halMinuteButton();
+
+// events, halWaitEvent() sleeps until at least one is pending and returns
+// them. The tick is the RTC's second, the first call returns one straight
+// away, and halTicks() counts them. halTimer() sets the animation timer's
+// period in ms, 0 stops it, and setting the same period again keeps its
+// phase.
+
+#define HAL_EVENT_TICK 0x01
+#define HAL_EVENT_BUTTON 0x02
+#define HAL_EVENT_SERIAL 0x04
+#define HAL_EVENT_TIMER 0x08
+
+extern void halEventBegin();
+extern uint32_t halTicks();
+extern void halTimer(uint16_t period);
+extern uint8_t halWaitEvent();
+
+// output frames, the meter values and pixels for a coming tick staged
+// ahead so the tick interrupt puts the meters out on its edge and the
+// pixels follow as soon as halWaitEvent() wakes on it.
+// halFrameStage() takes the tick and the outputs the frame sets, the
+// pixels being those set since the last halPixelShow(). A frame for a
+// tick that has been and gone is dropped, and halFrameCancel() drops it
+// before the outputs are changed some other way. halFrameDone() returns
+// the outputs the current tick's frame put out, halFrameLatency() the
+// microseconds from the edge to the last frame being out and
+// halTickMicros() the microseconds since the current tick's edge.
+
+#define HAL_FRAME_HOUR 0x01
+#define HAL_FRAME_MINUTE 0x02
+#define HAL_FRAME_PIXELS 0x04
+
+extern void halFrameStage(uint32_t tick, uint8_t outputs, uint16_t hour, uint16_t minute);
+extern void halFrameCancel();
+extern uint8_t halFrameDone();
+extern uint16_t halFrameLatency();
+extern uint32_t halTickMicros();
+
+#endif
@@ -0,0 +1,404 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Hardware abstraction for the clock's board, a DS3231 RTC, the meters
+// on D5 and D6, the NeoPixels on D10 and the ATmega32U4's EEPROM.
+//
+// Between events the CPU idles with the timers still running for the
+// meter PWM. The DS3231's 1 Hz SQW output on D7 and pin change interrupts
+// on the adjust buttons wake it, as do Timer0's millis() tick and the USB
+// interrupts, which also see to the animation timer and serial input.
+//
+// The SQW interrupt writes a staged output frame's meter values itself.
+// Its pixels are sent from the NeoPixel library's buffer by halWaitEvent()
+// as it wakes on the same edge, as show() turns interrupts back on when
+// it is done and holds them off for the whole strip.
+//
+
+#include "hal.h"
+
+#if !HAL_LINUX
+
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <avr/eeprom.h>
+#include <util/atomic.h>
+#include <EEPROM.h>
+#include <Adafruit_NeoPixel.h>
+
+#include "config.h"
+
+// a second without SQW and the ticks fall back to millis()
+
+#define TICK_TIMEOUT 1100
+
+static RTC_DS3231 rtc;
+static volatile uint32_t sqwTicks;          // SQW edges
+static volatile unsigned long sqwMillis;    // millis() at the last one
+static volatile unsigned long sqwMicros;    // and micros()
+static volatile bool tickPending;
+static volatile bool buttonPending;
+static uint32_t lastTicks;
+static bool firstTick;
+static uint16_t timerPeriod;
+static unsigned long timerNext;
+static volatile uint8_t frameOutputs;       // HAL_FRAME_ bits staged
+static uint32_t frameTick;                  // for this tick
+static uint16_t frameHour;
+static uint16_t frameMinute;
+static volatile bool framePixels;           // pixels to send for the last edge
+static volatile uint8_t frameDone;          // put out on the last edge
+static volatile uint32_t frameDoneTick;
+static volatile uint16_t frameLatency;
+static HalDither hourDither;
+static HalDither minuteDither;
+static Adafruit_NeoPixel pixel = Adafruit_NeoPixel(NEOPIXEL_COUNT, NEOPIXEL, NEO_GRB + NEO_KHZ800);
+
+//
+// clock source
+//
+
+bool halClockBegin() {
+    return rtc.begin();
+}
+
+bool halClockLostPower() {
+    return rtc.lostPower();
+}
+
+DateTime halClockNow() {
+    return rtc.now();
+}
+
+void halClockAdjust(const DateTime &time) {
+    rtc.adjust(time);
+}
+
+//
+// meter outputs, D5 with Timer3 set up for 10 bit PWM and
+// D6 with Timer4 set up for 10 bit PWM. A value with a fraction turns
+// on the timer's overflow interrupt to dither the count for each
+// period, a whole count turns it off again.
+//
+
+void halMeterBegin() {
+    pinMode(HOURPWM, OUTPUT);	// hour pwm pin
+    pinMode(MINPWM, OUTPUT);	// minute pwm pin
+
+    // D5 is OC3A, phase correct 10 bit at clk/8 runs at 977Hz
+
+    TCCR3A = (1<<COM3A1)|(1<<WGM31)|(1<<WGM30);
+    TCCR3B = (1<<CS31);
+    OCR3A = 0;
+
+    TCCR4E |= (1<<ENHC4);
+    TCCR4B &= ~(1<<CS41);
+    TCCR4B |= (1<<CS42)|(1<<CS40);
+    TCCR4D |= (1<<WGM40);
+    TC4H = 0x3;
+    OCR4C = 0xFF;
+    TCCR4C |= (1<<COM4D1)|(1<<PWM4D);
+}
+
+static void minuteCount(uint16_t count) {
+    TC4H = count>>8;
+    OCR4D = (count&0xFF);
+}
+
+#if METER_DITHER
+
+// the overflows come at the bottom of each period and the counts
+// written take effect at the next
+
+ISR(TIMER3_OVF_vect) {
+    OCR3A = halDitherNext(&hourDither);
+}
+
+ISR(TIMER4_OVF_vect) {
+    minuteCount(halDitherNext(&minuteDither));
+}
+
+void halHourMeter(uint16_t value) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        hourDither.value = value;
+
+        if (value & METER_FRACTION) {
+            TIMSK3 |= (1<<TOIE3);
+        } else {
+            TIMSK3 &= ~(1<<TOIE3);
+            OCR3A = value >> METER_FRACTION_BITS;
+        }
+    }
+}
+
+void halMinuteMeter(uint16_t value) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        minuteDither.value = value;
+
+        if (value & METER_FRACTION) {
+            TIMSK4 |= (1<<TOIE4);
+        } else {
+            TIMSK4 &= ~(1<<TOIE4);
+            minuteCount(value >> METER_FRACTION_BITS);
+        }
+    }
+}
+
+#else
+
+void halHourMeter(uint16_t value) {
+    OCR3A = (value+8) >> METER_FRACTION_BITS;
+}
+
+void halMinuteMeter(uint16_t value) {
+    minuteCount((value+8) >> METER_FRACTION_BITS);
+}
+
+#endif
+
+//
+// pixel output
+//
+
+void halPixelBegin() {
+    pixel.begin();
+}
+
+void halPixelSet(uint16_t n, uint32_t color) {
+    pixel.setPixelColor(n, color);
+}
+
+void halPixelFill(uint32_t color) {
+    pixel.fill(color);
+}
+
+void halPixelShow() {
+    pixel.show();
+}
+
+//
+// persistent storage
+//
+
+uint8_t halStorageRead(int address) {
+    return EEPROM.read(address);
+}
+
+void halStorageWrite(int address, uint8_t value) {
+    EEPROM.update(address, value);
+}
+
+void halStorageReadBlock(int address, void *data, uint16_t size) {
+    eeprom_read_block(data, (const void *)address, size);
+}
+
+void halStorageWriteBlock(int address, const void *data, uint16_t size) {
+    eeprom_update_block(data, (void *)address, size);
+}
+
+//
+// buttons, pulled up and low while pressed
+//
+
+void halButtonBegin() {
+    pinMode(HOURADJ, INPUT);	// hour adjust pin
+    pinMode(MINADJ, INPUT);		// minute adjust pin
+}
+
+bool halHourButton() {
+    return digitalRead(HOURADJ) == LOW;
+}
+
+bool halMinuteButton() {
+    return digitalRead(MINADJ) == LOW;
+}
+
+//
+// events
+//
+
+static void sqwFalling() {
+    sqwMicros = micros();
+    sqwTicks++;
+    sqwMillis = millis();
+    tickPending = true;
+
+    // write the meters staged for this tick, interrupts are off until
+    // the return, and leave the pixels to framePixelsShow()
+
+    frameDone = 0;
+    frameDoneTick = sqwTicks;
+    framePixels = false;
+
+    if (frameOutputs && frameTick == sqwTicks) {
+        if (frameOutputs & HAL_FRAME_HOUR)
+            halHourMeter(frameHour);
+        if (frameOutputs & HAL_FRAME_MINUTE)
+            halMinuteMeter(frameMinute);
+
+        framePixels = frameOutputs & HAL_FRAME_PIXELS;
+        frameDone = frameOutputs & ~HAL_FRAME_PIXELS;
+        frameLatency = micros()-sqwMicros;
+    }
+
+    frameOutputs = 0;
+}
+
+// send the pixels of the frame the last edge put out, straight after it
+
+static void framePixelsShow() {
+    noInterrupts();
+    bool show = framePixels;
+    framePixels = false;
+    interrupts();
+
+    if (show) {
+        pixel.show();
+
+        noInterrupts();
+        frameDone |= HAL_FRAME_PIXELS;
+        frameLatency = micros()-sqwMicros;
+        interrupts();
+    }
+}
+
+// HOURADJ and MINADJ are PB4 and PB7
+
+ISR(PCINT0_vect) {
+    buttonPending = true;
+}
+
+void halEventBegin() {
+    pinMode(SQWINT, INPUT_PULLUP);		// SQW is open drain
+    rtc.writeSqwPinMode(DS3231_SquareWave1Hz);
+    attachInterrupt(digitalPinToInterrupt(SQWINT), sqwFalling, FALLING);
+
+    PCMSK0 |= (1<<PCINT4)|(1<<PCINT7);
+    PCIFR = (1<<PCIF0);
+    PCICR |= (1<<PCIE0);
+
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    sqwMillis = millis();
+    firstTick = true;
+}
+
+uint32_t halTicks() {
+    noInterrupts();
+    uint32_t ticks = sqwTicks;
+    unsigned long since = millis()-sqwMillis;
+    interrupts();
+
+    // without SQW count on in seconds of millis() from the last edge
+    if (since >= TICK_TIMEOUT)
+        ticks += since/1000;
+
+    return ticks;
+}
+
+void halTimer(uint16_t period) {
+    if (period != timerPeriod) {
+        timerPeriod = period;
+        timerNext = millis()+period;
+    }
+}
+
+uint8_t halWaitEvent() {
+    uint8_t events = 0;
+
+    for (;;) {
+        framePixelsShow();
+
+        noInterrupts();
+        if (buttonPending)
+            events |= HAL_EVENT_BUTTON;
+        tickPending = false;
+        buttonPending = false;
+        interrupts();
+
+        uint32_t ticks = halTicks();
+        unsigned long ms = millis();
+
+        if (ticks != lastTicks || firstTick) {
+            events |= HAL_EVENT_TICK;
+            lastTicks = ticks;
+            firstTick = false;
+        }
+
+        if (timerPeriod && (long)(ms-timerNext) >= 0) {
+            events |= HAL_EVENT_TIMER;
+            // skipping any steps missed while busy, in the menu say
+            timerNext += ((ms-timerNext)/timerPeriod+1)*timerPeriod;
+        }
+
+        if (Serial.available())
+            events |= HAL_EVENT_SERIAL;
+
+        if (events)
+            return events;
+
+        // the flags are checked again with interrupts off so an edge
+        // between the check above and sleeping is not slept through
+
+        noInterrupts();
+        if (!tickPending && !buttonPending) {
+            sleep_enable();
+            interrupts();
+            sleep_cpu();
+            sleep_disable();
+        }
+        interrupts();
+    }
+}
+
+//
+// output frames
+//
+
+void halFrameStage(uint32_t tick, uint8_t outputs, uint16_t hour, uint16_t minute) {
+    noInterrupts();
+    frameTick = tick;
+    frameOutputs = outputs;
+    frameHour = hour;
+    frameMinute = minute;
+    interrupts();
+}
+
+void halFrameCancel() {
+    noInterrupts();
+    frameOutputs = 0;
+    framePixels = false;
+    interrupts();
+}
+
+uint8_t halFrameDone() {
+    noInterrupts();
+    uint8_t done = frameDone;
+    uint32_t tick = frameDoneTick;
+    interrupts();
+
+    // without SQW the frames don't go out
+    return tick == halTicks() ? done : 0;
+}
+
+uint16_t halFrameLatency() {
+    noInterrupts();
+    uint16_t latency = frameLatency;
+    interrupts();
+
+    return latency;
+}
+
+uint32_t halTickMicros() {
+    noInterrupts();
+    unsigned long edge = sqwMicros;
+    interrupts();
+
+    return micros()-edge;
+}
+
+#endif
@@ -0,0 +1,794 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Hardware abstraction for the Linux simulation. The RTC runs from the
+// host's clock, the EEPROM is a file, the meters and pixels are kept
+// in variables a harness can read and can be traced.
+//
+// With -d the clock is virtual, delay() and halWaitEvent() move it on
+// instead of waiting, and the sketch runs for the given number of days
+// from the -s date as fast as the host allows, then reports the loop
+// throughput and wake ups.
+//
+// Usage: panel_meter_clock [-v] [-t trace.csv] [-s yyyy-mm-dd[Thh:mm:ss]] [-d days] [eeprom file]
+//
+//     -v  trace the outputs to stderr
+//     -t  trace the outputs to a file
+//     -s  start the simulation at this local standard time, January 1st
+//         of this year by default
+//     -d  simulate this many days
+//
+// The trace is CSV, the RTC time in seconds since 1970 to the
+// millisecond, the output and its new value. Outputs are traced when
+// a write changes them, hour and minute with the PWM value in 1/16ths
+// of a count, the average the dither makes, and pixel0 up with the
+// colour as rrggbb.
+//
+// Build with HAL_LINUX_MAIN set to 0 to leave main() to a test program,
+// see tests/ and the README.
+//
+
+#include "hal.h"
+
+#if HAL_LINUX
+
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "config.h"
+
+#define STORAGE_SIZE 1024        // ATmega32U4 EEPROM
+
+#ifndef HAL_LINUX_MAIN
+#define HAL_LINUX_MAIN 1
+#endif
+
+uint16_t halLinuxHourMeter;
+uint16_t halLinuxMinuteMeter;
+uint32_t halLinuxPixels[NEOPIXEL_COUNT];
+bool halLinuxHourPressed;
+bool halLinuxMinutePressed;
+unsigned long halLinuxDelayed;
+
+HalConsole Serial;
+
+static FILE *trace = NULL;
+static const char *storageFile = "eeprom.bin";
+static uint8_t storage[STORAGE_SIZE];
+static bool storageLoaded = false;
+static long clockOffset;        // RTC seconds less host seconds
+static bool consoleEof = false;
+static bool simulating = false;
+static uint32_t simStart;       // host seconds when the virtual clock started
+static uint64_t simMicros;      // and the microseconds since
+static bool firstTick;
+static uint32_t tickStart;      // host second at halEventBegin()
+static uint32_t lastTicks;
+static long clockReads;         // halClockNow() calls
+static long clockWrites;        // and halClockAdjust()
+static uint16_t timerPeriod;
+static uint64_t timerNext;      // elapsedMicros() of the next step
+static bool hourPressed;
+static bool minutePressed;
+static uint8_t frameOutputs;     // HAL_FRAME_ bits staged
+static uint32_t frameTick;       // for this tick
+static uint16_t frameHour;
+static uint16_t frameMinute;
+static uint8_t frameDone;        // put out on the last tick
+static uint32_t frameDoneTick;
+static uint16_t frameLatency;
+
+//
+// Arduino core
+//
+
+static uint64_t monotonicMicros() {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec*1000000ULL+now.tv_nsec/1000;
+}
+
+static uint64_t startMicros = monotonicMicros();
+
+static uint64_t elapsedMicros() {
+    return simulating ? simMicros : monotonicMicros()-startMicros;
+}
+
+unsigned long millis() {
+    return elapsedMicros()/1000;
+}
+
+unsigned long micros() {
+    return elapsedMicros();
+}
+
+void delay(unsigned long ms) {
+    struct timespec wait = { (time_t)(ms/1000), (long)(ms%1000)*1000000L };
+
+    halLinuxDelayed += ms;
+
+    if (simulating)
+        simMicros += ms*1000ULL;
+    else
+        nanosleep(&wait, NULL);
+}
+
+//
+// host time in seconds, virtual when simulating
+//
+
+static uint32_t hostSeconds() {
+    return simulating ? simStart+simMicros/1000000 : time(NULL);
+}
+
+//
+// RTC time for the trace, to the millisecond
+//
+
+static double traceSeconds() {
+    struct timespec now;
+
+    if (simulating)
+        return simStart+clockOffset+simMicros/1e6;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    return now.tv_sec+clockOffset+now.tv_nsec/1e9;
+}
+
+char *itoa(int value, char *buffer, int radix) {
+    char digits[34];
+    unsigned int magnitude = value < 0 && radix == 10 ? -(unsigned int)value : (unsigned int)value;
+    int n = 0;
+    char *out = buffer;
+
+    do {
+        digits[n++] = "0123456789abcdefghijklmnopqrstuvwxyz"[magnitude % radix];
+        magnitude /= radix;
+    } while (magnitude);
+
+    if (value < 0 && radix == 10)
+        *out++ = '-';
+
+    while (n)
+        *out++ = digits[--n];
+
+    *out = 0;
+    return buffer;
+}
+
+char *dtostrf(double value, signed char width, unsigned char precision, char *buffer) {
+    sprintf(buffer, "%*.*f", width, precision, value);
+    return buffer;
+}
+
+//
+// console
+//
+
+void HalConsole::begin(unsigned long) {
+    setvbuf(stdout, NULL, _IONBF, 0);
+}
+
+int HalConsole::available() {
+    struct pollfd input = { STDIN_FILENO, POLLIN, 0 };
+
+    if (consoleEof)
+        return 0;
+
+    return poll(&input, 1, 0) > 0;
+}
+
+int HalConsole::read() {
+    unsigned char c;
+
+    if (!available())
+        return -1;
+
+    if (::read(STDIN_FILENO, &c, 1) != 1) {
+        consoleEof = true;
+        return -1;
+    }
+
+    return c == '\n' ? '\r' : c;
+}
+
+size_t HalConsole::print(const char *text) {
+    return fputs(text, stdout) < 0 ? 0 : strlen(text);
+}
+
+size_t HalConsole::print(const __FlashStringHelper *text) {
+    return print((const char *)text);
+}
+
+size_t HalConsole::print(const String &text) {
+    return print(text.c_str());
+}
+
+size_t HalConsole::print(char c) {
+    return putchar(c) == EOF ? 0 : 1;
+}
+
+size_t HalConsole::print(unsigned char value, int base) {
+    return print((unsigned long)value, base);
+}
+
+size_t HalConsole::print(int value, int base) {
+    return print((long)value, base);
+}
+
+size_t HalConsole::print(unsigned int value, int base) {
+    return print((unsigned long)value, base);
+}
+
+size_t HalConsole::print(long value, int base) {
+    if (value < 0 && base == 10)
+        return print('-')+print(-(unsigned long)value, base);
+
+    return print((unsigned long)value, base);
+}
+
+size_t HalConsole::print(unsigned long value, int base) {
+    char digits[33];
+    int n = sizeof(digits)-1;
+
+    digits[n] = 0;
+    do {
+        digits[--n] = "0123456789ABCDEF"[value % base];
+        value /= base;
+    } while (value);
+
+    return print(&digits[n]);
+}
+
+size_t HalConsole::print(double value, int digits) {
+    return printf("%.*f", digits, value);
+}
+
+size_t HalConsole::println() {
+    return print("\r\n");
+}
+
+//
+// RTClib's TimeSpan and DateTime
+//
+
+static const uint8_t daysInMonth[12] = {
+    31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+};
+
+#define SECONDS_FROM_1970_TO_2000 946684800UL
+
+static uint16_t date2days(uint16_t y, uint8_t m, uint8_t d) {
+    if (y >= 2000)
+        y -= 2000;
+
+    uint16_t days = d;
+    for (uint8_t i = 1; i < m; i++)
+        days += daysInMonth[i-1];
+
+    if (m > 2 && y % 4 == 0)
+        days++;
+
+    return days+365*y+(y+3)/4-1;
+}
+
+TimeSpan::TimeSpan(int32_t seconds) : _seconds(seconds) {
+}
+
+TimeSpan::TimeSpan(int16_t days, int8_t hours, int8_t minutes, int8_t seconds) :
+    _seconds((int32_t)days*86400L+(int32_t)hours*3600+(int32_t)minutes*60+seconds) {
+}
+
+DateTime::DateTime(uint32_t t) {
+    t -= SECONDS_FROM_1970_TO_2000;
+
+    ss = t % 60;
+    t /= 60;
+    mm = t % 60;
+    t /= 60;
+    hh = t % 24;
+
+    uint16_t days = t/24;
+    uint8_t leap;
+
+    for (yOff = 0; ; yOff++) {
+        leap = yOff % 4 == 0;
+        if (days < 365+leap)
+            break;
+        days -= 365+leap;
+    }
+
+    for (m = 1; m < 12; m++) {
+        uint8_t length = daysInMonth[m-1]+(m == 2 && leap);
+        if (days < length)
+            break;
+        days -= length;
+    }
+
+    d = days+1;
+}
+
+DateTime::DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second) {
+    yOff = year >= 2000 ? year-2000 : year;
+    m = month;
+    d = day;
+    hh = hour;
+    mm = minute;
+    ss = second;
+}
+
+//
+// from the compiler's __DATE__ and __TIME__, "Apr 21 2020" and "12:34:56"
+//
+
+DateTime::DateTime(const __FlashStringHelper *date, const __FlashStringHelper *time) {
+    static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    const char *text = (const char *)date;
+    char name[4] = { text[0], text[1], text[2], 0 };
+
+    m = (strstr(months, name)-months)/3+1;
+    d = atoi(text+4);
+    yOff = atoi(text+9);
+
+    text = (const char *)time;
+    hh = atoi(text);
+    mm = atoi(text+3);
+    ss = atoi(text+6);
+}
+
+uint8_t DateTime::twelveHour() const {
+    if (hh == 0 || hh == 12)
+        return 12;
+
+    return hh % 12;
+}
+
+uint8_t DateTime::dayOfTheWeek() const {
+    // 1/1/2000 was a Saturday
+    return (date2days(yOff, m, d)+6) % 7;
+}
+
+uint32_t DateTime::unixtime() const {
+    return SECONDS_FROM_1970_TO_2000+((date2days(yOff, m, d)*24UL+hh)*60+mm)*60+ss;
+}
+
+String DateTime::timestamp() const {
+    char buffer[32];
+
+    sprintf(buffer, "%04d-%02d-%02dT%02d:%02d:%02d", year(), m, d, hh, mm, ss);
+    return buffer;
+}
+
+DateTime DateTime::operator+(const TimeSpan &span) const {
+    return DateTime(unixtime()+span.totalseconds());
+}
+
+DateTime DateTime::operator-(const TimeSpan &span) const {
+    return DateTime(unixtime()-span.totalseconds());
+}
+
+TimeSpan DateTime::operator-(const DateTime &right) const {
+    return TimeSpan((int32_t)(unixtime()-right.unixtime()));
+}
+
+//
+// clock source, the host's local standard time until it is adjusted
+//
+
+bool halClockBegin() {
+    time_t host = time(NULL);
+    struct tm local;
+
+    if (simulating)
+        return true;
+
+    localtime_r(&host, &local);
+    clockOffset = DateTime(local.tm_year+1900, local.tm_mon+1, local.tm_mday,
+        local.tm_hour, local.tm_min, local.tm_sec).unixtime()-host;
+
+    if (local.tm_isdst > 0)
+        clockOffset -= 3600;
+
+    return true;
+}
+
+bool halClockLostPower() {
+    return false;
+}
+
+DateTime halClockNow() {
+    clockReads++;
+    return DateTime((uint32_t)(hostSeconds()+clockOffset));
+}
+
+void halClockAdjust(const DateTime &time) {
+    clockOffset = (long)time.unixtime()-hostSeconds();
+    clockWrites++;
+}
+
+//
+// meter outputs
+//
+
+void halMeterBegin() {
+}
+
+void halHourMeter(uint16_t value) {
+    if (trace && value != halLinuxHourMeter)
+        fprintf(trace, "%.3f,hour,%u\n", traceSeconds(), value);
+
+    halLinuxHourMeter = value;
+}
+
+void halMinuteMeter(uint16_t value) {
+    if (trace && value != halLinuxMinuteMeter)
+        fprintf(trace, "%.3f,minute,%u\n", traceSeconds(), value);
+
+    halLinuxMinuteMeter = value;
+}
+
+//
+// pixel output, the colours are traced when shown if they changed
+//
+
+static uint32_t shownPixels[NEOPIXEL_COUNT];
+
+void halPixelBegin() {
+}
+
+void halPixelSet(uint16_t n, uint32_t color) {
+    if (n < NEOPIXEL_COUNT)
+        halLinuxPixels[n] = color;
+}
+
+void halPixelFill(uint32_t color) {
+    for (int n = 0; n < NEOPIXEL_COUNT; n++)
+        halLinuxPixels[n] = color;
+}
+
+void halPixelShow() {
+    for (int n = 0; n < NEOPIXEL_COUNT; n++) {
+        if (trace && halLinuxPixels[n] != shownPixels[n])
+            fprintf(trace, "%.3f,pixel%d,%06x\n", traceSeconds(), n, (unsigned int)halLinuxPixels[n]);
+
+        shownPixels[n] = halLinuxPixels[n];
+    }
+}
+
+//
+// persistent storage, read from the file on first use and written
+// through, a missing file reads as an erased EEPROM and without a file
+// it is kept in memory
+//
+
+static void storageLoad() {
+    FILE *file = storageFile ? fopen(storageFile, "rb") : NULL;
+
+    memset(storage, 0xff, sizeof(storage));
+
+    if (file) {
+        if (fread(storage, 1, sizeof(storage), file) != sizeof(storage))
+            fprintf(stderr, "%s is short, the rest reads as erased\n", storageFile);
+        fclose(file);
+    }
+
+    storageLoaded = true;
+}
+
+void halLinuxStorage(const char *file) {
+    storageFile = file;
+    storageLoaded = false;
+}
+
+uint8_t halStorageRead(int address) {
+    if (!storageLoaded)
+        storageLoad();
+
+    return storage[address % STORAGE_SIZE];
+}
+
+static void storageSave() {
+    FILE *file = storageFile ? fopen(storageFile, "wb") : NULL;
+
+    if (file) {
+        fwrite(storage, 1, sizeof(storage), file);
+        fclose(file);
+    }
+}
+
+void halStorageWrite(int address, uint8_t value) {
+    if (halStorageRead(address) == value)
+        return;
+
+    storage[address % STORAGE_SIZE] = value;
+    storageSave();
+}
+
+void halStorageReadBlock(int address, void *data, uint16_t size) {
+    uint8_t *bytes = (uint8_t *)data;
+
+    for (uint16_t n = 0; n < size; n++)
+        bytes[n] = halStorageRead(address+n);
+}
+
+// the file is written once for the block
+
+void halStorageWriteBlock(int address, const void *data, uint16_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    bool changed = false;
+
+    for (uint16_t n = 0; n < size; n++) {
+        if (halStorageRead(address+n) != bytes[n]) {
+            storage[(address+n) % STORAGE_SIZE] = bytes[n];
+            changed = true;
+        }
+    }
+
+    if (changed)
+        storageSave();
+}
+
+//
+// buttons
+//
+
+void halButtonBegin() {
+}
+
+bool halHourButton() {
+    return halLinuxHourPressed;
+}
+
+bool halMinuteButton() {
+    return halLinuxMinutePressed;
+}
+
+//
+// events, the tick is on the host's second, which the RTC's second
+// follows. The virtual clock jumps straight to the next event. A staged
+// output frame goes out when its tick is seen.
+//
+
+void halEventBegin() {
+    tickStart = hostSeconds();
+    firstTick = true;
+}
+
+uint32_t halTicks() {
+    return hostSeconds()-tickStart;
+}
+
+void halTimer(uint16_t period) {
+    if (period != timerPeriod) {
+        timerPeriod = period;
+        timerNext = elapsedMicros()+period*1000ULL;
+    }
+}
+
+//
+// put out the frame staged for the tick as the SQW interrupt and
+// halWaitEvent() do, when the tick is seen
+//
+
+static void frameCommit(uint32_t ticks) {
+    frameDone = 0;
+    frameDoneTick = ticks;
+
+    if (frameOutputs && frameTick == ticks) {
+        if (frameOutputs & HAL_FRAME_HOUR)
+            halHourMeter(frameHour);
+        if (frameOutputs & HAL_FRAME_MINUTE)
+            halMinuteMeter(frameMinute);
+        if (frameOutputs & HAL_FRAME_PIXELS)
+            halPixelShow();
+
+        frameDone = frameOutputs;
+        frameLatency = halTickMicros();
+    }
+
+    frameOutputs = 0;
+}
+
+static uint8_t pendingEvents() {
+    uint8_t events = 0;
+    uint32_t ticks = halTicks();
+    uint64_t now = elapsedMicros();
+
+    if (ticks != lastTicks || firstTick) {
+        events |= HAL_EVENT_TICK;
+        lastTicks = ticks;
+        firstTick = false;
+        frameCommit(ticks);
+    }
+
+    if (halLinuxHourPressed != hourPressed || halLinuxMinutePressed != minutePressed) {
+        events |= HAL_EVENT_BUTTON;
+        hourPressed = halLinuxHourPressed;
+        minutePressed = halLinuxMinutePressed;
+    }
+
+    if (timerPeriod && now >= timerNext) {
+        events |= HAL_EVENT_TIMER;
+        // skipping any steps missed while busy
+        timerNext += ((now-timerNext)/(timerPeriod*1000ULL)+1)*timerPeriod*1000ULL;
+    }
+
+    if (Serial.available())
+        events |= HAL_EVENT_SERIAL;
+
+    return events;
+}
+
+uint8_t halWaitEvent() {
+    for (;;) {
+        uint8_t events = pendingEvents();
+
+        if (events)
+            return events;
+
+        // microseconds to the next second and the next timer step
+
+        uint64_t now = elapsedMicros();
+        uint64_t next;
+
+        if (simulating) {
+            next = (simMicros/1000000+1)*1000000;
+        } else {
+            struct timespec host;
+
+            clock_gettime(CLOCK_REALTIME, &host);
+            next = now+1000000-host.tv_nsec/1000;
+        }
+
+        if (timerPeriod && timerNext < next)
+            next = timerNext;
+
+        if (simulating) {
+            simMicros = next;
+        } else {
+            struct pollfd input = { STDIN_FILENO, POLLIN, 0 };
+
+            poll(&input, consoleEof ? 0 : 1, (next-now)/1000+1);
+        }
+    }
+}
+
+//
+// output frames
+//
+
+void halFrameStage(uint32_t tick, uint8_t outputs, uint16_t hour, uint16_t minute) {
+    frameTick = tick;
+    frameOutputs = outputs;
+    frameHour = hour;
+    frameMinute = minute;
+}
+
+void halFrameCancel() {
+    frameOutputs = 0;
+}
+
+uint8_t halFrameDone() {
+    return frameDoneTick == halTicks() ? frameDone : 0;
+}
+
+uint16_t halFrameLatency() {
+    return frameLatency;
+}
+
+uint32_t halTickMicros() {
+    struct timespec host;
+
+    if (simulating)
+        return simMicros % 1000000;
+
+    clock_gettime(CLOCK_REALTIME, &host);
+    return host.tv_nsec/1000;
+}
+
+//
+// start the virtual clock at a local standard time given as
+// yyyy-mm-dd or yyyy-mm-ddThh:mm:ss
+//
+
+bool halLinuxSimulate(const char *start) {
+    int year;
+    int month;
+    int day;
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+
+    if (sscanf(start, "%d-%d-%dT%d:%d:%d", &year, &month, &day, &hour, &minute, &second) < 3 ||
+        year < 2000 || year > 2099 || month < 1 || month > 12 || day < 1 || day > 31)
+        return false;
+
+    // millis() carries on if the clock was already running
+    simStart = DateTime(year, month, day, hour, minute, second).unixtime()-simMicros/1000000;
+    simulating = true;
+    return true;
+}
+
+#if HAL_LINUX_MAIN
+
+//
+// run the sketch, in real time or for a number of simulated days
+//
+
+int main(int argc, char **argv) {
+    long days = 0;
+    const char *start = NULL;
+
+    for (int arg = 1; arg < argc; arg++) {
+        if (!strcmp(argv[arg], "-v")) {
+            trace = stderr;
+        } else if (!strcmp(argv[arg], "-t") && arg+1 < argc) {
+            trace = fopen(argv[++arg], "w");
+            if (!trace) {
+                perror(argv[arg]);
+                return 1;
+            }
+            fprintf(trace, "seconds,output,value\n");
+        } else if (!strcmp(argv[arg], "-s") && arg+1 < argc) {
+            start = argv[++arg];
+        } else if (!strcmp(argv[arg], "-d") && arg+1 < argc) {
+            days = atol(argv[++arg]);
+        } else {
+            halLinuxStorage(argv[arg]);
+        }
+    }
+
+    if (days > 0) {
+        time_t host = time(NULL);
+        struct tm local;
+        char thisYear[32];
+
+        localtime_r(&host, &local);
+        sprintf(thisYear, "%d-01-01", local.tm_year+1900);
+
+        if (!halLinuxSimulate(start ? start : thisYear)) {
+            fprintf(stderr, "bad start %s, use yyyy-mm-dd[Thh:mm:ss]\n", start);
+            return 1;
+        }
+    }
+
+    setup();
+
+    if (!simulating) {
+        for (;;)
+            loop();
+    }
+
+    uint64_t end = days*86400ULL*1000000;
+    uint64_t began = monotonicMicros();
+    unsigned long long loops = 0;
+
+    while (simMicros < end) {
+        loop();
+        loops++;
+    }
+
+    double wall = (monotonicMicros()-began)/1e6;
+
+    if (trace)
+        fflush(trace);
+
+    fprintf(stderr, "simulated %ld days, %llu loops in %.2f s, %.0f loops/s, %.0fx real time\n",
+        days, loops, wall, loops/wall, end/1e6/wall);
+    fprintf(stderr, "%.0f wake ups and %.1f ms of host CPU per simulated hour\n",
+        loops/(days*24.0), wall*1000/(days*24.0));
+    fprintf(stderr, "%.1f RTC reads per simulated day, %ld writes\n", clockReads/(double)days, clockWrites);
+
+    return 0;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,164 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The parts of the Arduino core and RTClib the sketch uses, for the
+// Linux simulation in hal_linux.cpp. Included by hal.h when HAL_LINUX
+// is set.
+//
+
+#ifndef __HAL_LINUX_H__
+#define __HAL_LINUX_H__
+
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+//
+// Arduino core
+//
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef std::string String;
+
+#define LOW 0
+#define HIGH 1
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+class __FlashStringHelper;
+#define F(string) ((const __FlashStringHelper *)(string))
+
+#define radians(deg) ((deg)*(M_PI/180))
+#define degrees(rad) ((rad)*(180/M_PI))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+extern unsigned long millis();
+extern unsigned long micros();
+extern void delay(unsigned long ms);
+
+extern char *itoa(int value, char *buffer, int radix);
+extern char *dtostrf(double value, signed char width, unsigned char precision, char *buffer);
+
+static inline bool isPrintable(int c) {
+    return isprint(c);
+}
+
+//
+// console on stdin and stdout, a return reads as CR as it does
+// from the serial monitor
+//
+
+class HalConsole {
+public:
+    void begin(unsigned long baud);
+    int available();
+    int read();
+
+    size_t print(const char *text);
+    size_t print(const __FlashStringHelper *text);
+    size_t print(const String &text);
+    size_t print(char c);
+    size_t print(unsigned char value, int base = 10);
+    size_t print(int value, int base = 10);
+    size_t print(unsigned int value, int base = 10);
+    size_t print(long value, int base = 10);
+    size_t print(unsigned long value, int base = 10);
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+
+    template <typename T> size_t println(T value) {
+        return print(value)+println();
+    }
+
+    template <typename T> size_t println(T value, int format) {
+        return print(value, format)+println();
+    }
+};
+
+extern HalConsole Serial;
+
+//
+// RTClib's TimeSpan and DateTime, 2000 to 2099
+//
+
+class TimeSpan {
+public:
+    TimeSpan(int32_t seconds = 0);
+    TimeSpan(int16_t days, int8_t hours, int8_t minutes, int8_t seconds);
+
+    int32_t totalseconds() const { return _seconds; }
+
+private:
+    int32_t _seconds;
+};
+
+class DateTime {
+public:
+    DateTime(uint32_t t = 946684800UL);
+    DateTime(uint16_t year, uint8_t month, uint8_t day,
+        uint8_t hour = 0, uint8_t minute = 0, uint8_t second = 0);
+    DateTime(const __FlashStringHelper *date, const __FlashStringHelper *time);
+
+    uint16_t year() const { return 2000+yOff; }
+    uint8_t month() const { return m; }
+    uint8_t day() const { return d; }
+    uint8_t hour() const { return hh; }
+    uint8_t twelveHour() const;
+    uint8_t minute() const { return mm; }
+    uint8_t second() const { return ss; }
+    uint8_t dayOfTheWeek() const;
+    uint32_t unixtime() const;
+    String timestamp() const;
+
+    DateTime operator+(const TimeSpan &span) const;
+    DateTime operator-(const TimeSpan &span) const;
+    TimeSpan operator-(const DateTime &right) const;
+    bool operator<(const DateTime &right) const { return unixtime() < right.unixtime(); }
+    bool operator==(const DateTime &right) const { return unixtime() == right.unixtime(); }
+    bool operator!=(const DateTime &right) const { return unixtime() != right.unixtime(); }
+
+private:
+    uint8_t yOff, m, d, hh, mm, ss;
+};
+
+//
+// simulated hardware, for harnesses driving the sketch
+//
+
+extern uint16_t halLinuxHourMeter;
+extern uint16_t halLinuxMinuteMeter;
+extern uint32_t halLinuxPixels[];
+extern bool halLinuxHourPressed;
+extern bool halLinuxMinutePressed;
+extern unsigned long halLinuxDelayed;      // ms spent in delay()
+
+// start the virtual clock at a local standard time, yyyy-mm-dd or
+// yyyy-mm-ddThh:mm:ss, false if it won't parse
+
+extern bool halLinuxSimulate(const char *start);
+
+// keep the EEPROM in a file, or in memory if NULL, erased to begin with
+
+extern void halLinuxStorage(const char *file);
+
+// the sketch
+
+extern void setup();
+extern void loop();
+
+#endif
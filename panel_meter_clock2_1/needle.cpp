@@ -0,0 +1,342 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Needle animation, see needle.h. Positions are kept in 1/256ths of an
+// hour or minute so a move can start from part way through another.
+//
+
+#include "hal.h"
+#include "config.h"
+#include "needle.h"
+#include "fastmath.h"
+
+// spring rate of EASE_DAMPED over the whole move, settled to 0.7%
+// before the end, which is scaled away
+
+#define DAMPED_RATE 7.0f
+
+// the spline's knots, the hours and every fifth minute
+
+#define KNOTS 13
+#define MINUTE_KNOT NEEDLE_POSITION(5)
+
+// the shaper's impulses, their weights in 1/4096ths
+
+#define IMPULSES 3
+#define SHAPE_ONE 4096
+
+struct Move {
+    uint16_t from;          // in 1/256ths of a step
+    uint16_t to;
+    uint16_t duration;      // ms
+    unsigned long start;    // millis() at the start
+    uint8_t easing;
+};
+
+struct Needle {
+    uint16_t position;      // put out now, shaped
+    Move move;              // being made
+    Move last;              // and the one before, still in the shaper
+    bool moving;
+};
+
+struct Shape {
+    uint8_t impulses;
+    uint16_t weights[IMPULSES];
+    uint16_t delays[IMPULSES];  // ms, in whole NEEDLE_STEPs
+};
+
+static Needle needles[2];
+static Shape shapes[2];
+
+// the spline's slope at each knot in PWM per knot, in 1/16ths of a
+// count as the calibration is
+
+static int16_t slopes[2][KNOTS];
+
+//
+// the calibration point for a knot
+//
+
+static uint16_t knotValue(uint8_t meter, uint8_t knot) {
+    return meter == NEEDLE_HOUR ? HOURS_CAL[knot] : MINUTES_CAL[knot*5];
+}
+
+//
+// work out the slopes at the knots, Fritsch and Butland's harmonic mean
+// of the slopes either side, or flat where they differ in sign, keeps
+// the spline from overshooting between the calibration points. The end
+// knots take the slope of their one side.
+//
+
+void needleFit() {
+    for (uint8_t meter = 0; meter < 2; meter++) {
+        int32_t before = 0;
+
+        for (uint8_t knot = 0; knot < KNOTS; knot++) {
+            int32_t after = knot < KNOTS-1 ?
+                (int32_t)knotValue(meter, knot+1)-knotValue(meter, knot) : before;
+            int32_t slope;
+
+            if (knot == 0)
+                slope = after;
+            else if ((before < 0) != (after < 0) || !before || !after)
+                slope = 0;
+            else
+                slope = lround(2.0*before*after/(before+after));
+
+            slopes[meter][knot] = constrain(slope, -32767, 32767);
+            before = after;
+        }
+    }
+}
+
+//
+// the meter's PWM for a position, the cubic between the knots either
+// side in Horner's form with t in 1/256ths, rounded to the nearest from
+// the minutes' 1/1280ths. The sums are kept in 1/16ths of the
+// calibration's units so only the result is rounded.
+//
+
+static uint16_t needlePwm(uint8_t meter, uint16_t position) {
+    uint8_t knot;
+    int32_t t;
+
+    if (meter == NEEDLE_HOUR) {
+        knot = position >> 8;
+        t = position & 0xFF;
+    } else {
+        knot = position/MINUTE_KNOT;
+        t = (position-knot*MINUTE_KNOT+2)/5;
+    }
+
+    if (knot >= KNOTS-1)
+        return knotValue(meter, KNOTS-1);
+
+    int32_t from = knotValue(meter, knot);
+    int32_t rise = (int32_t)knotValue(meter, knot+1)-from;
+    int32_t m0 = slopes[meter][knot];
+    int32_t m1 = slopes[meter][knot+1];
+    int32_t c2 = 3*rise-2*m0-m1;
+    int32_t c3 = m0+m1-2*rise;
+
+    int32_t value = (c3*t) >> 4;
+    value = ((value+c2*16)*t) >> 8;
+    value = ((value+m0*16)*t) >> 8;
+
+    return from+((value+8) >> 4);
+}
+
+static void needleWrite(uint8_t meter, uint16_t position) {
+    if (meter == NEEDLE_HOUR)
+        halHourMeter(needlePwm(meter, position));
+    else
+        halMinuteMeter(needlePwm(meter, position));
+}
+
+//
+// how far along the curve a move is, both 0 to 65536
+//
+
+static uint32_t ease(uint8_t easing, uint32_t t) {
+    uint32_t rest = 65536-t;
+
+    switch (easing) {
+        case EASE_OUT: {
+            // 1-(1-t)^3, halved before each multiply as 65536^2 overflows
+            uint32_t squared = ((rest >> 1)*(rest >> 1)) >> 14;
+            return 65536-(((squared >> 1)*(rest >> 1)) >> 14);
+        }
+
+        case EASE_DAMPED: {
+            // 1-(1+wt)e^-wt, stretched to end at 1
+            float wt = DAMPED_RATE*t/65536.0f;
+#if FAST_MATH
+            float left = (1+wt)*fast_exp(-wt);
+#else
+            float left = (1+wt)*exp(-wt);
+#endif
+            static const float end = 1-(1+DAMPED_RATE)*exp(-DAMPED_RATE);
+
+            return (1-left)/end*65536.0f+0.5f;
+        }
+
+        default:
+            return t;
+    }
+}
+
+//
+// work out each meter's shaper from its natural frequency and damping,
+// the weights K^n and the delays n half periods apart, where K is how
+// far the ringing dies away in half a period
+//
+
+void needleShape() {
+    for (uint8_t meter = 0; meter < 2; meter++) {
+        Shape *shape = &shapes[meter];
+        float damping = meterDamping[meter]/100.0f;
+        float root = sqrt(1-damping*damping);
+        float k = exp(-damping*M_PI/root);
+        float half = 5000.0f/(meterFrequency[meter]*root);
+        float weights[IMPULSES];
+        uint16_t rest = SHAPE_ONE;
+
+        switch (shaper) {
+            case SHAPE_ZV:
+                shape->impulses = 2;
+                weights[1] = k/(1+k);
+            break;
+
+            case SHAPE_ZVD:
+                shape->impulses = 3;
+                weights[1] = 2*k/((1+k)*(1+k));
+                weights[2] = k*k/((1+k)*(1+k));
+            break;
+
+            default:
+                shape->impulses = 1;
+            break;
+        }
+
+        // the first takes what the others leave, so a settled needle
+        // comes to exactly where it was sent
+
+        for (uint8_t n = 1; n < shape->impulses; n++) {
+            shape->weights[n] = weights[n]*SHAPE_ONE+0.5f;
+            shape->delays[n] = lround(n*half/NEEDLE_STEP)*NEEDLE_STEP;
+            rest -= shape->weights[n];
+        }
+
+        shape->weights[0] = rest;
+        shape->delays[0] = 0;
+
+        // heavily damped, the last impulses can round away to nothing
+
+        while (shape->impulses > 1 && !shape->weights[shape->impulses-1])
+            shape->impulses--;
+    }
+}
+
+//
+// where the move sends a needle at a time, before it is shaped. Before
+// the move started it is where the last one sent it.
+//
+
+static uint16_t command(const Needle *needle, unsigned long time) {
+    const Move *move = &needle->move;
+
+    if ((long)(time-move->start) < 0) {
+        move = &needle->last;
+
+        if ((long)(time-move->start) < 0)
+            return move->from;
+    }
+
+    unsigned long elapsed = time-move->start;
+
+    if (elapsed >= move->duration)
+        return move->to;
+
+    int32_t along = ease(move->easing, (elapsed << 16)/move->duration);
+    int32_t distance = (int32_t)move->to-move->from;
+
+    return move->from+((distance*along) >> 16);
+}
+
+//
+// and after, the sum of the delayed and weighted commands
+//
+
+static uint16_t shaped(uint8_t meter, unsigned long time) {
+    const Shape *shape = &shapes[meter];
+    uint32_t sum = SHAPE_ONE/2;
+
+    for (uint8_t n = 0; n < shape->impulses; n++)
+        sum += (uint32_t)shape->weights[n]*command(&needles[meter], time-shape->delays[n]);
+
+    return sum >> 12;
+}
+
+// how long the move lasts with the shaper's last impulse
+
+static unsigned long moveEnd(uint8_t meter) {
+    const Shape *shape = &shapes[meter];
+
+    return (unsigned long)needles[meter].move.duration+shape->delays[shape->impulses-1];
+}
+
+//
+// start a move to position, which steps there through the shaper if
+// the duration is 0
+//
+
+void needleMove(uint8_t meter, uint16_t position, uint16_t duration, uint8_t easing) {
+    Needle *needle = &needles[meter];
+    unsigned long now = millis();
+    Move *move = &needle->move;
+
+    needle->last = *move;
+
+    move->from = command(needle, now);
+    move->to = position;
+    move->duration = duration;
+    move->easing = easing;
+    move->start = now;
+
+    needle->position = shaped(meter, now);
+    needle->moving = moveEnd(meter) && (move->from != move->to || needle->position != move->to);
+
+    if (!needle->moving)
+        needle->position = move->to;
+
+    needleWrite(meter, needle->position);
+}
+
+//
+// move the needles on to where they should be by now, returns
+// true while either is still moving
+//
+
+bool needleUpdate() {
+    unsigned long now = millis();
+
+    for (uint8_t meter = 0; meter < 2; meter++) {
+        Needle *needle = &needles[meter];
+
+        if (!needle->moving)
+            continue;
+
+        if (now-needle->move.start >= moveEnd(meter)) {
+            needle->position = needle->move.to;
+            needle->moving = false;
+        } else {
+            needle->position = shaped(meter, now);
+        }
+
+        needleWrite(meter, needle->position);
+    }
+
+    return needleMoving();
+}
+
+//
+// the PWM a settled needle is put to first on a step to position, the
+// first of the shaper's impulses, for staging an output frame
+//
+
+uint16_t needleValue(uint8_t meter, uint16_t position) {
+    uint16_t from = needles[meter].move.to;
+    uint32_t first = shapes[meter].weights[0];
+
+    return needlePwm(meter, (first*position+(SHAPE_ONE-first)*from+SHAPE_ONE/2) >> 12);
+}
+
+bool needleMoving() {
+    return needles[NEEDLE_HOUR].moving || needles[NEEDLE_MINUTE].moving;
+}
@@ -0,0 +1,69 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#ifndef __NEEDLE_H__
+#define __NEEDLE_H__
+
+#include "hal.h"
+
+//
+// Needle animation for the hour and minute meters.
+//
+// A move runs from wherever the needle is to a position, the hour 0-12
+// or the minute 0-60 in 1/256ths, over a duration with an easing curve.
+// Nothing blocks, needleUpdate() moves the needles on a step each time
+// the loop's animation timer fires, every NEEDLE_STEP ms while
+// needleMoving() is true.
+//
+// The PWM for a position comes from a monotone cubic spline through the
+// calibration points, the hours and every fifth minute, so the needles
+// can sit anywhere between them. needleFit() works the spline's slopes
+// out again after the calibration changes.
+//
+// Each meter is a second order system, its needle rings at its natural
+// frequency and dies away with its damping, so every move goes through
+// an input shaper before the PWM is worked out. The shaper adds copies
+// of the move delayed by half the meter's ringing period, weighted so
+// the ringing each starts cancels that of the others. ZV takes two
+// copies, ZVD three, lasting a period, but copes better with a meter
+// that is not quite as set. A move keeps needleMoving() true until the
+// last copy has arrived, and needleShape() works the shapers out again
+// after the settings change. tests/ballistics_test.cpp runs the moves
+// through a model of the meters.
+//
+
+#define NEEDLE_HOUR 0
+#define NEEDLE_MINUTE 1
+
+#define NEEDLE_STEP 20
+
+// a whole hour or minute as a position
+
+#define NEEDLE_POSITION(n) ((uint16_t)(n) << 8)
+
+// easing curves
+
+#define EASE_LINEAR 0       // constant speed
+#define EASE_OUT 1          // fast start slowing into the end, cubic
+#define EASE_DAMPED 2       // a critically damped spring, no overshoot
+#define EASE_COUNT 3
+
+// input shapers
+
+#define SHAPE_NONE 0
+#define SHAPE_ZV 1          // zero vibration, half a period
+#define SHAPE_ZVD 2         // and zero derivative, a whole period
+#define SHAPE_COUNT 3
+
+extern void needleFit();
+extern void needleShape();
+extern void needleMove(uint8_t meter, uint16_t position, uint16_t duration, uint8_t easing);
+extern bool needleUpdate();
+extern bool needleMoving();
+extern uint16_t needleValue(uint8_t meter, uint16_t position);
+
+#endif
@@ -5,13 +5,10 @@
 // Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
 //
 
-#include <avr/pgmspace.h>
-#include <EEPROM.h>
-#include <RTClib.h>
-#include <Adafruit_NeoPixel.h>
 #include <stdint.h>
 #include <math.h>
 
+#include "hal.h"
 #include "config.h"
 
 int dosetdate = 0;	// set to 1 to always set date/time to compiled time.
@@ -36,8 +33,22 @@ int dosetdate = 0;	// set to 1 to always set date/time to compiled time.
 #include "colourcalc.h"
 perez colour;
 
+#include "skytable.h"
+#include "softclock.h"
+#include "needle.h"
+#include "buttons.h"
+#include "tz.h"
+#include "clocktime.h"
+#include "fixtrig.h"
+#include "fastmath.h"
+
 // Prototypes
 float level(float in);
+void calcPixelColor(uint8_t mode, uint8_t glob_scale, long seconds);
+void calcSkyPixels(long seconds);
+void stageFrame();
+uint16_t hourPosition(const ClockTime *time);
+uint16_t minutePosition(const ClockTime *time);
 
 // Globals
 
@@ -47,100 +58,133 @@ float theta_sun;
 float scalar = 3;
 float turbidity = 1.8;
 
-int dstActive = 0;
+SolarEphemeris ephemeris;
+SolarTracker tracker;
+SolarEvents events;
+
+long litStart;			// seconds past midnight the sky colour is lit
+long litEnd;
+long colorEvals = 0;	// sky colour evaluations and dark seconds skipped today
+long colorSkips = 0;
+long lastColorEvals = 0;	// and yesterday
+long lastColorSkips = 0;
+
+int16_t utcOffset;			// minutes east of UTC at the last now()
+int16_t lastOffset;
 int	lastDay = -1;
-int lastHour = -1;
+int lastHour = -1;			// needle positions, see hourPosition()
 int lastMinute = -1;
+int lastSecond = -1;
 int colorStep = 0;
+unsigned long wheelStepped;	// millis() at the last colour wheel step
 
-Adafruit_NeoPixel pixel = Adafruit_NeoPixel(1, NEOPIXEL, NEO_GRB + NEO_KHZ800);
-RTC_DS3231 rtc;
+ClockTime nextTime;			// the time the staged output frame is for
+unsigned long framesOnEdge = 0;	// ticks whose outputs went out on the edge
+unsigned long framesLate = 0;	// and that the loop put out after it
+unsigned long lateMicros = 0;	// how long after the edge, the last time
+unsigned long maxLateMicros = 0;
+
+#if NEOPIXEL_COUNT > 1
+float sky_view[NEOPIXEL_COUNT];		// view zenith angle of each pixel
+float sky_R[NEOPIXEL_COUNT];		// and its colour
+float sky_G[NEOPIXEL_COUNT];
+float sky_B[NEOPIXEL_COUNT];
+#endif
 
 //
-// Returns 1 if DST should be active today
+// Returns the current local time in seconds since 1970, adjusting for
+// daylight saving time by the time zone's rules
 //
 
-int isDST(int day, int month, int dow) {
-   if (month < 3 || month > 11) {
-      return 0;
-   }
-   if (month > 3 && month < 11) {
-      return 1;
-   }
-   int previousSunday = day - dow;
-   if (month == 3) {
-      return previousSunday >= 8;
-   }
-   return previousSunday <= 0;
+uint32_t now(void) {
+
+	// get the time from the soft clock, kept in step with the RTC
+	uint32_t standard = softClockSeconds();
+	int16_t shift = tzShift(standard);
+
+	utcOffset = tzStandardOffset()+shift;
+
+	return standard+shift*60L;
 }
 
 //
-// Returns the current time as a DateTime object adjusting for
-// US daylight saving time as needed if dstObs is set to a true value
+// Typical turbidity in tenths by month for the northern hemisphere,
+// clearest in winter and haziest in the summer, shifted six months
+// south of the equator.
+//
+
+const uint8_t TURBIDITY_MONTHLY[12] PROGMEM = {
+	18, 18, 19, 21, 23, 25, 26, 25, 22, 20, 19, 18
+};
+
+//
+// Returns the turbidity for the given date, the setting or, when it is
+// TURBIDITY_SEASONAL, the monthly curve interpolated between the middle
+// of each month. Rounded to tenths so the coefficient sets cached by
+// the Perez model are reused.
 //
 
-DateTime now(void) {
+float calcTurbidity(int month, int day) {
+	if (turbiditySetting != TURBIDITY_SEASONAL)
+		return turbiditySetting/10.0;
 
-    // get the time from the RTC
-    DateTime theTime = rtc.now();
+	int first = month-1;
+	float frac = (day-15)/30.0;
 
-    // check if DST is observed in this location
-    if (dstObs) {
-        // check if DST should be in effect today
-        if (isDST(theTime.day(), theTime.month(), theTime.dayOfTheWeek())) {
-            // if DST is not currently active & it is after 02:00
-            if (!dstActive && theTime.hour() >= 2)
-                dstActive = 1;          // make DST active
-        } else {
-            // if DST is currently active & it is after 02:00
-        if (dstActive && theTime.hour() >= 2)
-            dstActive = 0;  // make DST not active
-        }
-    } else {
-		dstActive = 0;	// DST not observed so not active
+	if (frac < 0) {
+		first += 11;
+		frac += 1;
 	}
 
-	// if DST is active spring forward one hour
-    if (dstActive)
-        return theTime + TimeSpan(0, 1, 0, 0);
+	if (latitude < 0)
+		first += 6;
+
+	int16_t from = pgm_read_byte(&TURBIDITY_MONTHLY[first % 12]);
+	int16_t to = pgm_read_byte(&TURBIDITY_MONTHLY[(first+1) % 12]);
 
-	// DST is not active use RTC time directly
-	return theTime;
+	return (int)(from+(to-from)*frac+0.5)/10.0;
 }
 
 //
-// Calculates the solar max using the height of the sun
-// in radians at solar noon for the current day.
+// Calculates today's solar ephemeris, events, turbidity and lit window and
+// returns the solar max using the height of the sun in radians at
+// solar noon.
+//
+// The colour scalar is zero once the sun is more than 60 degrees
+// past the solar max, so the lit window runs from when the sun
+// crosses that angle in the morning to when it crosses it again,
+// with a couple of minutes to spare either side.
 //
 
 float calcSolarMax() {
-	int solarNoonHour;
-	int solarNoonMinute;
-
-	theTime = now();
-	float solarNoon = calcSolarNoon(
+	clockTimeTo(&theTime, now());
+	calcSolarEphemeris(
+		&ephemeris,
 		latitude,
 		longitude,
-		theTime.year(),
-		theTime.month(),
-		theTime.day(),
-		gmtOffset
+		theTime.year,
+		theTime.month,
+		theTime.day,
+		utcOffset
 	);
+	resetSolarTracker(&tracker);
+	calcSolarEvents(&events, &ephemeris);
+	turbidity = calcTurbidity(theTime.month, theTime.day);
+
+	float rise;
+	float set;
+	bool crosses = calcSolarCrossing(&ephemeris, ephemeris.noonZenith+60, &rise, &set);
+
+	if (!crosses || rise < 0 || set > 1) {
+		// lit all day, or the window wraps round midnight
+		litStart = 0;
+		litEnd = 86400L;
+	} else {
+		litStart = rise*86400L-120;
+		litEnd = set*86400L+120;
+	}
 
-	decToHourMinute(solarNoon, &solarNoonHour, &solarNoonMinute);
-
-	return radians(
-		calcSolarZenithAngle(
-			latitude,
-			longitude,
-			theTime.year(),
-			theTime.month(),
-			theTime.day(),
-			solarNoonHour,
-			solarNoonMinute,
-			gmtOffset
-		)
-	);
+	return radians(ephemeris.noonZenith);
 }
 
 //
@@ -150,37 +194,19 @@ float calcSolarMax() {
 void setup() {
     Serial.begin(9600);
 
-	// Check EEPROM for calibration data
-
-	if (EEPROM[EEPROM_SENTINEL] != 'P' && EEPROM[EEPROM_SENTINEL+1] != 'M' &&EEPROM[EEPROM_SENTINEL+2] != 'C') {
-		configCreate();
-	}
+	// Load the settings, or the defaults when EEPROM has none
 
 	//configCreate();  // uncomment to override EEPROM settings with defaults
 	configLoad();
 
-    pinMode(HOURPWM, OUTPUT);	// hour pwm pin
-    pinMode(MINPWM, OUTPUT);	// minute pwm pin
-    pinMode(HOURADJ, INPUT);	// hour adjust pin
-    pinMode(MINADJ, INPUT);		// minute adjust pin
-
-	//
-	// Set D6 to 10 bit PWM
-	//
-
-    TCCR4E |= (1<<ENHC4);
-    TCCR4B &= ~(1<<CS41);
-    TCCR4B |= (1<<CS42)|(1<<CS40);
-    TCCR4D |= (1<<WGM40);
-    TC4H = 0x3;
-    OCR4C = 0xFF;
-    TCCR4C |= (1<<COM4D1)|(1<<PWM4D);
+    halMeterBegin();		// meter pwm pins, D6 10 bit
+    halButtonBegin();		// adjust pins
 
 	//
     // Start the clock
 	//
 
-    if (! rtc.begin()) {
+    if (! halClockBegin()) {
 		while(1) {
         	Serial.println(F("Could not find RTC!"));
 			delay(1000);
@@ -191,11 +217,18 @@ void setup() {
 	// if the RTC lost power set the RTC to the date & time this sketch was compiled
 	//
 
-    if (dosetdate || rtc.lostPower()) {
+    if (dosetdate || halClockLostPower()) {
         Serial.println(F("RTC was NOT running!"));
-        rtc.adjust(DateTime(F(__DATE__), F(__TIME__)));
+        halClockAdjust(DateTime(F(__DATE__), F(__TIME__)));
     }
 
+	//
+	// Wake on the RTC's second, the buttons and serial input,
+	// the soft clock counts the seconds from here
+	//
+
+	halEventBegin();
+
 	//
 	// Get the solar max for today
 	//
@@ -206,11 +239,21 @@ void setup() {
 	// Start the NeoPixel
 	//
 
-    pixel.begin();
+    halPixelBegin();
 	if (colorMode == MODE_FIXED) {
-		pixel.setPixelColor(0, pixel.Color(r, g, b));
-		pixel.show();
+		setColor(halPixelColor(r, g, b));
+	}
+
+#if NEOPIXEL_COUNT > 1
+	//
+	// Spread the pixels from the sky angle down at the
+	// horizon end of the strip up to the zenith
+	//
+
+	for (int i = 0; i < NEOPIXEL_COUNT; i++) {
+		sky_view[i] = sky_angle*(NEOPIXEL_COUNT-1-i)/(NEOPIXEL_COUNT-1);
 	}
+#endif
 
 	//
 	// Initialize the color class & coefficients
@@ -224,8 +267,7 @@ void setup() {
 //
 
 void updateMinute(uint16_t value) {
-	TC4H = value>>8;
-    OCR4D = (value&0xFF);
+	halMinuteMeter(value);
 }
 
 //
@@ -233,8 +275,8 @@ void updateMinute(uint16_t value) {
 //
 
 void setColor(uint32_t color) {
-   	pixel.setPixelColor(0, color);
-   	pixel.show();
+   	halPixelFill(color);
+   	halPixelShow();
 }
 
 //
@@ -244,18 +286,25 @@ void setColor(uint32_t color) {
 uint32_t Wheel(byte WheelPos) {
     WheelPos = 255 - WheelPos;
     if (WheelPos < 85) {
-        return pixel.Color(255 - WheelPos * 3, 0, WheelPos * 3);
+        return halPixelColor(255 - WheelPos * 3, 0, WheelPos * 3);
     }
     if (WheelPos < 170) {
         WheelPos -= 85;
-        return pixel.Color(0, WheelPos * 3, 255 - WheelPos * 3);
+        return halPixelColor(0, WheelPos * 3, 255 - WheelPos * 3);
     }
     WheelPos -= 170;
-    return pixel.Color(WheelPos * 3, 255 - WheelPos * 3, 0);
+    return halPixelColor(WheelPos * 3, 255 - WheelPos * 3, 0);
 }
 
 //
-// Main Loop
+// Main Loop, sleeps until the next event. The time is read and the
+// meters and sky colour updated each second or after a button or the
+// menu. The needles and the colour wheel move on the animation timer,
+// every NEEDLE_STEP ms during a sweep and 100ms for the wheel.
+//
+// Each time the outputs for the next second are worked out ahead and
+// staged, so the tick puts them out on its edge instead of after the
+// loop has woken and worked them out.
 //
 
 void loop() {
@@ -263,126 +312,226 @@ void loop() {
 	int day;
     int	hour;
     int minute;
+    int second;
 
-	//
-	//	Bring up the configure menu if the
-	//	escape key is pressed
-	//
+	if (needleMoving() || buttonsBusy())
+		halTimer(NEEDLE_STEP);
+	else
+		halTimer(colorMode == MODE_WHEEL ? 100 : 0);
 
-	if (Serial.available()) {
-		char ch = Serial.read();
-		if (ch == 27)
-			configMenu();
-	}
+	uint8_t events = halWaitEvent();
+	bool stepped = false;
 
 	//
-	//	Advance the hour if the hour adjust button
-	// 	is pressed and released
+	//	Debounce the adjust buttons, stepping the hour or minute
+	//		on a press and repeating while held
 	//
 
-    if (digitalRead(HOURADJ) == LOW)  {
-        while (digitalRead(HOURADJ) == LOW)
-            delay(50);
+	if (events & (HAL_EVENT_BUTTON|HAL_EVENT_TIMER))
+		stepped = buttonsUpdate();
 
-        rtc.adjust(rtc.now() + TimeSpan(0, 1, 0, 0));
-    }
+	if (events & HAL_EVENT_TIMER) {
+		needleUpdate();
 
-	//
-	//	Advance the minute if the minute adjust button
-	// 	is pressed and released
-	//
+		//
+		//	Step the NeoPixel color to the next color
+		//		every 100ms
+		//
 
-    if (digitalRead(MINADJ) == LOW)  {
-        while (digitalRead(MINADJ) == LOW)
-            delay(50);
+		if (colorMode == MODE_WHEEL && millis()-wheelStepped >= 100) {
+			wheelStepped = millis();
+			colorStep++;
+			colorStep %= 255;
+			setColor(Wheel(colorStep));
+		}
+	}
 
-        rtc.adjust(rtc.now() + TimeSpan(0, 0, 1, 0));
-    }
+	if (!stepped && !(events & (HAL_EVENT_TICK|HAL_EVENT_SERIAL)))
+		return;
 
 	//
-	// Get the current time
+	//	Bring up the configure menu if the
+	//	escape key is pressed
 	//
 
-    theTime = now();
+	if (Serial.available()) {
+		char ch = Serial.read();
+		if (ch == 27) {
+			halFrameCancel();
+			configMenu();
+		}
+	}
+
+	//
+	// Get the current time, the fields carry on from the last
+	//
 
-    hour = theTime.twelveHour();
-    if (hour == 12)
-    	hour = 0;
+    clockTimeTo(&theTime, now());
+	uint8_t done = halFrameDone();
+	bool late = false;
 
-    minute = theTime.minute();
+    hour = hourPosition(&theTime);
+    minute = minutePosition(&theTime);
+    second = theTime.second;
 
     //
     // if the day has changed
-    //  calculate the solar max for the day
+    //  calculate the solar max for the day, and again
+    //  if the clocks have changed as it is on local time
     //
 
-	day = theTime.day();
+	day = theTime.day;
 	if (day != lastDay) {
 		theta_max = calcSolarMax();
 		lastDay = day;
+
+		lastColorEvals = colorEvals;
+		lastColorSkips = colorSkips;
+		colorEvals = 0;
+		colorSkips = 0;
+	} else if (utcOffset != lastOffset) {
+		theta_max = calcSolarMax();
 	}
 
+	lastOffset = utcOffset;
+
 	//
-	// if the hour has changed update the hour meter,
-	//		sweep the meter back if last hour was 12
+	// if the hour has changed, or moved on gliding, update the hour meter,
+	//		sweeping the meter back when it goes back,
+	//		unless the tick's frame has already moved it
 	//
 
     if (hour != lastHour) {
-        if (lastHour == 12) {
-            for (int i = lastHour; i != 0; i--) {
-                analogWrite(HOURPWM, HOURS_CAL[i]);
-                delay(1000 / 12);
-            }
-        }
-        else
-            analogWrite(HOURPWM, HOURS_CAL[hour]);
-
+        needleMove(NEEDLE_HOUR, hour, hour < lastHour ? sweepTime*100 : 0, sweepEasing);
+        late |= !(done & HAL_FRAME_HOUR);
         lastHour = hour;
     }
 
 	//
-	// if the minute has changed update the minute meter,
-	//		sweep the meter back if last minute was 59
+	// if the minute has changed, or moved on gliding, update the minute meter,
+	//		sweeping the meter back when it goes back
 	//
 
     if (minute != lastMinute) {
-        if (lastMinute == 59) {
-            for (int i = lastMinute; i != 0; i--) {
-                updateMinute(MINUTES_CAL[i]);
-                delay(1000 / 59);
-            }
-        }
-        else
-            updateMinute(MINUTES_CAL[minute]);
-
+        needleMove(NEEDLE_MINUTE, minute, minute < lastMinute ? sweepTime*100 : 0, sweepEasing);
+        late |= !(done & HAL_FRAME_MINUTE);
         lastMinute = minute;
+    }
 
-        // Update the NeoPixel color
+	//
+	// if the second has changed update the NeoPixel color,
+	//		unless the tick's frame has already shown it
+	//
 
-    	if (colorMode == MODE_SUN) {
-    		setPixelColor(sky_angle, 255);
-    	} else if (colorMode == MODE_SKY) {
-    		setPixelColor(sky_angle-(M_PI/2), 255);
+    if (second != lastSecond) {
+    	if ((colorMode == MODE_SUN || colorMode == MODE_SKY) && !(done & HAL_FRAME_PIXELS)) {
+    		calcSkyPixels(clockTimeOfDay(&theTime));
+    		halPixelShow();
+    		late = true;
     	}
+
+        lastSecond = second;
     }
 
 	//
-	//	Step the NeoPixel color to the next color
-	//		and wait 100ms
+	// count the ticks the outputs went out on and
+	//		those they went out late on
 	//
 
-	if (colorMode == MODE_WHEEL) {
-    	colorStep++;
-    	colorStep %= 255;
-    	pixel.setPixelColor(0, Wheel(colorStep));
-    	pixel.show();
+	if (events & HAL_EVENT_TICK) {
+		if (late) {
+			lateMicros = halTickMicros();
+			if (lateMicros > maxLateMicros)
+				maxLateMicros = lateMicros;
+			framesLate++;
+		} else if (done) {
+			framesOnEdge++;
+		}
+	}
+
+	stageFrame();
+}
+
+//
+// Work out the outputs for the next second and stage them to go out
+// together on its tick's edge. A needle that is moving or would sweep
+// back is left to the loop, as are the pixels on a new day or when the
+// clocks change, which need the solar values worked out again first.
+//
+
+void stageFrame() {
+	uint32_t tick = halTicks()+1;
+	uint32_t standard = softClockSeconds()+1;
+	int16_t shift = tzShift(standard);
+	uint8_t outputs = 0;
+	uint16_t hour;
+	uint16_t minute;
+
+	nextTime = theTime;
+	clockTimeTo(&nextTime, standard+shift*60L);
+
+	hour = hourPosition(&nextTime);
+	minute = minutePosition(&nextTime);
+
+	if (!needleMoving()) {
+		if (hour != lastHour && !(hour < lastHour && sweepTime))
+			outputs |= HAL_FRAME_HOUR;
+
+		if (minute != lastMinute && !(minute < lastMinute && sweepTime))
+			outputs |= HAL_FRAME_MINUTE;
+	}
+
+	if ((colorMode == MODE_SUN || colorMode == MODE_SKY) &&
+		nextTime.day == theTime.day && tzStandardOffset()+shift == utcOffset) {
+		calcSkyPixels(clockTimeOfDay(&nextTime));
+		outputs |= HAL_FRAME_PIXELS;
 	}
 
-    delay(100);
+	halFrameStage(tick, outputs, needleValue(NEEDLE_HOUR, hour), needleValue(NEEDLE_MINUTE, minute));
+}
+
+//
+// the needle positions for a time in 1/256ths of an hour and of a minute,
+// gliding on with the minutes and seconds when set to
+//
+
+uint16_t hourPosition(const ClockTime *time) {
+	uint16_t position = NEEDLE_POSITION(time->hour % 12);
+
+	if (glide & GLIDE_HOUR)
+		position += NEEDLE_POSITION(time->minute)/60;
+
+	return position;
+}
+
+uint16_t minutePosition(const ClockTime *time) {
+	uint16_t position = NEEDLE_POSITION(time->minute);
+
+	if (glide & GLIDE_MINUTE)
+		position += NEEDLE_POSITION(time->second)/60;
+
+	return position;
+}
+
+//
+// set the NeoPixels for the seconds past midnight without showing them,
+//		the solar tracker keeps this cheap and outside the
+//		lit window the pixels are just turned off
+//
+
+void calcSkyPixels(long seconds) {
+	if (seconds < litStart || seconds >= litEnd) {
+		halPixelFill(0);
+		colorSkips++;
+	} else {
+		calcPixelColor(colorMode, 255, seconds);
+		colorEvals++;
+	}
 }
 
 //
-// calculate and set the NeoPixel color
+// calculate and set the NeoPixel color for the seconds past
+// midnight, without showing it
 //
 // color calculation code based on:
 //
@@ -400,43 +549,191 @@ float level(float in)
 	return in;
 }
 
-void setPixelColor(float sky_angle, uint8_t glob_scale)
+//
+// gamma correct a colour channel, from the table in
+// fastmath.cpp when FAST_MATH is set
+//
+
+float gammaCorrect(float in, float gamma)
+{
+#if FAST_MATH
+	(void)gamma;		// the table's exponent is fixed by gammatable.py
+	return fast_gamma(in);
+#else
+	return pow(level(in), gamma);
+#endif
+}
+
+#if NEOPIXEL_COUNT > 1
+
+//
+// strip version, draws the sky from the horizon to the zenith with the
+// sun dependent part of the Perez model shared by all the pixels. The
+// sun and sky modes both draw the same gradient.
+//
+
+void calcPixelColor(uint8_t mode, uint8_t glob_scale, long seconds)
+{
+    float theta_sun;
+    float gamma = 1/1.8;
+
+	theta_sun = radians(
+		updateSolarTracker(
+			&tracker,
+			&ephemeris,
+			seconds
+		)
+	);
+
+	// the tracker can be a hair under max theta around noon
+	if (theta_sun < theta_max) {
+		theta_sun = theta_max;
+	}
+
+	scalar = level(cos((theta_sun-theta_max)*1.5));
+	colour.prepare(theta_sun, turbidity);
+	colour.calc_RGB_batch(sky_view, sky_R, sky_G, sky_B, NEOPIXEL_COUNT);
+
+	for (int i = 0; i < NEOPIXEL_COUNT; i++) {
+		uint8_t pr = gammaCorrect(sky_R[i], gamma)*scalar*glob_scale;
+		uint8_t pg = gammaCorrect(sky_G[i], gamma)*scalar*glob_scale;
+		uint8_t pb = gammaCorrect(sky_B[i], gamma)*scalar*glob_scale;
+
+		halPixelSet(i, halPixelColor(pr, pg, pb));
+	}
+}
+
+#elif SKY_TABLE
+
+//
+// table version, the colour for the zenith angle comes from skytabledata.h
+// and the scalar is worked out with the fixed point trig, so each update
+// is integer maths apart from converting the zenith angles
+//
+
+void calcPixelColor(uint8_t mode, uint8_t glob_scale, long seconds)
+{
+	uint8_t rgb[3];
+	uint16_t scalar = 0;
+
+	uint16_t zenith = updateSolarTracker(
+		&tracker,
+		&ephemeris,
+		seconds
+	)*(65536.0/360);
+	uint16_t zenith_max = theta_max*(32768/M_PI);
+
+	// scalar as in the analytic version below, cos((theta_sun-theta_max)*1.5)
+	// as a Q15 clamped to zero, with theta sun no less than max theta
+
+	int32_t past = 0;
+	if (zenith > zenith_max)
+		past = (int32_t)(zenith-zenith_max)*3/2;
+
+	if (past < BAM_90)
+		scalar = icos(past)+1;
+
+	skyTableLookup(mode == MODE_SKY ? SKY_VIEW_SKY : SKY_VIEW_SUN, turbidity*10+0.5, zenith, rgb);
+
+	r = ((uint32_t)rgb[0]*(glob_scale+1)*scalar) >> 23;
+	g = ((uint32_t)rgb[1]*(glob_scale+1)*scalar) >> 23;
+	b = ((uint32_t)rgb[2]*(glob_scale+1)*scalar) >> 23;
+
+  	halPixelSet(0, halPixelColor(r, g, b));
+}
+
+#else
+
+void calcPixelColor(uint8_t mode, uint8_t glob_scale, long seconds)
 {
 	RGB_value f_value;
     float theta_sun;
     float gamma = 1/1.8;
+    float angle = (mode == MODE_SKY) ? sky_angle-(M_PI/2) : sky_angle;
 
 	theta_sun = radians(
-		calcSolarZenithAngle(
-			latitude,
-			longitude,
-			theTime.year(),
-			theTime.month(),
-			theTime.day(),
-			theTime.hour(),
-			theTime.minute(),
-			gmtOffset
+		updateSolarTracker(
+			&tracker,
+			&ephemeris,
+			seconds
 		)
 	);
 
 	//check theta sun is valid, cant be less than max theta and 360 deg - max theta
-	if (theta_sun < theta_max || theta_sun > ((2*M_PI)-theta_max)) {
+	if (theta_sun > ((2*M_PI)-theta_max)) {
 		theta_sun = 3;
 	}
 
+	// the tracker can be a hair under max theta around noon
+	if (theta_sun < theta_max) {
+		theta_sun = theta_max;
+	}
+
 	// scalar function pulled output to zero when sun below civic twilight and then uses
 	// cosine distribution to scale the intensity from current to maximum sun angle (midday)
 
 	scalar = level(cos((theta_sun-theta_max)*1.5));
-	f_value = colour.calc_RGB_out(theta_sun*0.01745329252, sky_angle, turbidity);
-	f_value.R = (pow(level(f_value.R),(gamma))*scalar);
-	f_value.G = (pow(level(f_value.G),(gamma))*scalar);
-	f_value.B = (pow(level(f_value.B),(gamma))*scalar);
+	f_value = colour.calc_RGB_out(theta_sun, angle, turbidity);
+	f_value.R = (gammaCorrect(f_value.R, gamma)*scalar);
+	f_value.G = (gammaCorrect(f_value.G, gamma)*scalar);
+	f_value.B = (gammaCorrect(f_value.B, gamma)*scalar);
 
 	r = (uint8_t)(f_value.R*glob_scale);
 	g = (uint8_t)(f_value.G*glob_scale);
 	b = (uint8_t)(f_value.B*glob_scale);
 
-  	pixel.setPixelColor(0, pixel.Color(r, g, b));
-    pixel.show();
+  	halPixelSet(0, halPixelColor(r, g, b));
+}
+
+#endif
+
+//
+// calculate and show the NeoPixel color for theTime
+//
+
+void setPixelColor(uint8_t mode, uint8_t glob_scale)
+{
+	calcPixelColor(mode, glob_scale, clockTimeOfDay(&theTime));
+	halPixelShow();
+}
+
+//
+// time the Perez model for SKY_BENCH_PIXELS view angles, one at a time
+// and as a batch, and print the pixels per second for each
+//
+
+#define SKY_BENCH_PIXELS 16
+#define SKY_BENCH_PASSES 10
+
+void benchSky()
+{
+	float view[SKY_BENCH_PIXELS];
+	float R[SKY_BENCH_PIXELS];
+	float G[SKY_BENCH_PIXELS];
+	float B[SKY_BENCH_PIXELS];
+	unsigned long start;
+	unsigned long single;
+	unsigned long batch;
+
+	for (int i = 0; i < SKY_BENCH_PIXELS; i++)
+		view[i] = sky_angle*(SKY_BENCH_PIXELS-1-i)/(SKY_BENCH_PIXELS-1);
+
+	start = micros();
+	for (int pass = 0; pass < SKY_BENCH_PASSES; pass++) {
+		for (int i = 0; i < SKY_BENCH_PIXELS; i++)
+			colour.calc_RGB_out((pass+1)*0.1, view[i], turbidity);
+	}
+	single = micros()-start;
+
+	start = micros();
+	for (int pass = 0; pass < SKY_BENCH_PASSES; pass++) {
+		colour.prepare((pass+1)*0.1, turbidity);
+		colour.calc_RGB_batch(view, R, G, B, SKY_BENCH_PIXELS);
+	}
+	batch = micros()-start;
+
+	Serial.print(F("Single pixels/second: "));
+	Serial.println(SKY_BENCH_PIXELS*SKY_BENCH_PASSES*1000000.0/single);
+	Serial.print(F("Batch pixels/second:  "));
+	Serial.println(SKY_BENCH_PIXELS*SKY_BENCH_PASSES*1000000.0/batch);
 }
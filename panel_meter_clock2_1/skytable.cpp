@@ -0,0 +1,48 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#include "hal.h"
+#include <stdint.h>
+
+#include "skytable.h"
+
+#if SKY_TABLE
+
+#include "skytabledata.h"
+
+#define SKY_TABLE_SHIFT (15-SKY_TABLE_BITS)
+
+//
+// look up the gamma corrected colour of the given view for a turbidity in
+// tenths and a solar zenith angle (16 bit binary angle, 0 to 180 degrees),
+// interpolating between table entries. Regenerate skytabledata.h with
+// tools/skytable.py.
+//
+
+void skyTableLookup(uint8_t view, uint8_t turbidity, uint16_t zenith, uint8_t *rgb) {
+    if (turbidity < SKY_TABLE_TURBIDITY_MIN)
+        turbidity = SKY_TABLE_TURBIDITY_MIN;
+
+    if (turbidity > SKY_TABLE_TURBIDITY_MAX)
+        turbidity = SKY_TABLE_TURBIDITY_MAX;
+
+    if (zenith > 32767)
+        zenith = 32767;
+
+    uint8_t set = turbidity-SKY_TABLE_TURBIDITY_MIN;
+    uint8_t idx = zenith >> SKY_TABLE_SHIFT;
+    int16_t frac = zenith & ((1 << SKY_TABLE_SHIFT)-1);
+
+    for (uint8_t n = 0; n < 3; n++) {
+        int16_t first = pgm_read_byte(&SKY_TABLE_DATA[set][view][idx][n]);
+        int16_t next = pgm_read_byte(&SKY_TABLE_DATA[set][view][idx+1][n]);
+
+        rgb[n] = first+(((int32_t)(next-first)*frac+(1 << (SKY_TABLE_SHIFT-1))) >> SKY_TABLE_SHIFT);
+    }
+}
+
+#endif
@@ -0,0 +1,31 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#ifndef __SKYTABLE_H__
+#define __SKYTABLE_H__
+
+#include <stdint.h>
+
+//
+// Set SKY_TABLE to 1 to look the sun and sky colours up in the table in
+// skytabledata.h, built for the turbidity range and sky_angle set in the
+// sketch by tools/skytable.py, or 0 to run the Perez model in
+// colourcalc.cpp for every update.
+//
+
+#ifndef SKY_TABLE
+#define SKY_TABLE 1
+#endif
+
+// views in the table
+
+#define SKY_VIEW_SUN 0
+#define SKY_VIEW_SKY 1
+
+extern void skyTableLookup(uint8_t view, uint8_t turbidity, uint16_t zenith, uint8_t *rgb);
+
+#endif
@@ -0,0 +1,845 @@
+//
+// Generated by tools/skytable.py, do not edit.
+//
+// Gamma corrected sun and sky view colours for turbidity 1.8 to 4.0
+// in tenths, at 65 solar zenith angles from 0 to 180 degrees in 64 steps
+// of 2.81 degrees, 8970 bytes of flash.
+//
+// Worst case error against the analytic Perez model:
+//     sun 7.00, sky 19.00 RGB888 steps.
+//
+
+#define SKY_TABLE_BITS 6
+#define SKY_TABLE_TURBIDITY_MIN 18
+#define SKY_TABLE_TURBIDITY_MAX 40
+
+static const uint8_t SKY_TABLE_DATA[23][2][65][3] PROGMEM = {
+    {   // 1.8
+        {{255, 212,  25}, {255, 211,  25}, {255, 211,  25}, {255, 210,  25},
+         {255, 210,  25}, {255, 209,  26}, {255, 209,  26}, {255, 208,  26},
+         {255, 208,  27}, {255, 207,  27}, {255, 207,  27}, {255, 206,  28},
+         {255, 206,  28}, {255, 206,  29}, {255, 205,  29}, {255, 205,  29},
+         {255, 205,  30}, {255, 205,  30}, {255, 205,  30}, {255, 205,  30},
+         {255, 205,  30}, {255, 206,  30}, {255, 206,  30}, {255, 207,  29},
+         {255, 208,  29}, {255, 209,  28}, {255, 210,  27}, {255, 212,  26},
+         {255, 213,  25}, {255, 215,  24}, {255, 217,  22}, {255, 219,  21},
+         {255, 220,  19}, {255, 222,  16}, {255, 224,  14}, {255, 226,  10},
+         {255, 228,   5}, {255, 230,   0}, {255, 232,   0}, {255, 234,   0},
+         {255, 236,   0}, {255, 238,   0}, {255, 239,   0}, {255, 241,   0},
+         {255, 243,   0}, {255, 244,   0}, {255, 245,   0}, {255, 247,   0},
+         {255, 248,   0}, {255, 249,   0}, {255, 250,   0}, {255, 251,   0},
+         {255, 252,   0}, {255, 253,   0}, {255, 254,   0}, {255, 254,   0},
+         {255, 255,   0}, {254, 255,   0}, {254, 255,   0}, {253, 255,   0},
+         {253, 255,   0}, {252, 255,   0}, {252, 255,   0}, {252, 255,   0},
+         {251, 255,   0}},
+        {{179, 218, 255}, {180, 218, 255}, {180, 218, 255}, {180, 218, 255},
+         {179, 217, 255}, {177, 215, 255}, {175, 214, 255}, {173, 212, 255},
+         {171, 210, 255}, {168, 208, 255}, {165, 206, 255}, {163, 204, 255},
+         {160, 202, 255}, {157, 201, 255}, {155, 199, 255}, {153, 198, 255},
+         {151, 197, 255}, {149, 196, 255}, {148, 195, 255}, {148, 195, 255},
+         {148, 195, 255}, {149, 196, 255}, {150, 197, 255}, {152, 199, 255},
+         {156, 202, 255}, {160, 205, 255}, {165, 209, 255}, {172, 214, 255},
+         {179, 220, 255}, {189, 227, 255}, {200, 236, 255}, {212, 246, 255},
+         {225, 255, 252}, {230, 255, 239}, {235, 255, 225}, {240, 255, 210},
+         {244, 255, 194}, {249, 255, 176}, {254, 255, 158}, {255, 252, 136},
+         {255, 248, 113}, {255, 244,  88}, {255, 240,  58}, {255, 237,   0},
+         {255, 234,   0}, {255, 231,   0}, {255, 228,   0}, {255, 226,   0},
+         {255, 224,   0}, {255, 222,   0}, {255, 220,   0}, {255, 218,   0},
+         {255, 216,   0}, {255, 215,   0}, {255, 214,   0}, {255, 212,   0},
+         {255, 211,   0}, {255, 210,   0}, {255, 209,   0}, {255, 208,   0},
+         {255, 207,   0}, {255, 207,   0}, {255, 206,   0}, {255, 205,   0},
+         {255, 205,   0}}
+    },
+    {   // 1.9
+        {{255, 213,  41}, {255, 213,  41}, {255, 212,  41}, {255, 212,  41},
+         {255, 211,  41}, {255, 211,  42}, {255, 211,  42}, {255, 210,  43},
+         {255, 210,  43}, {255, 209,  43}, {255, 209,  44}, {255, 208,  44},
+         {255, 208,  45}, {255, 207,  45}, {255, 207,  46}, {255, 207,  46},
+         {255, 207,  47}, {255, 207,  47}, {255, 207,  47}, {255, 207,  47},
+         {255, 207,  47}, {255, 208,  47}, {255, 209,  47}, {255, 209,  46},
+         {255, 210,  45}, {255, 211,  45}, {255, 212,  43}, {255, 214,  42},
+         {255, 215,  41}, {255, 216,  39}, {255, 218,  37}, {255, 220,  35},
+         {255, 222,  33}, {255, 223,  30}, {255, 225,  27}, {255, 227,  24},
+         {255, 229,  20}, {255, 231,  15}, {255, 232,   9}, {255, 234,   0},
+         {255, 236,   0}, {255, 237,   0}, {255, 239,   0}, {255, 240,   0},
+         {255, 242,   0}, {255, 243,   0}, {255, 244,   0}, {255, 245,   0},
+         {255, 246,   0}, {255, 247,   0}, {255, 248,   0}, {255, 249,   0},
+         {255, 250,   0}, {255, 251,   0}, {255, 251,   0}, {255, 252,   0},
+         {255, 253,   0}, {255, 253,   0}, {255, 254,   0}, {255, 254,   0},
+         {255, 255,   0}, {255, 255,   0}, {255, 255,   0}, {254, 255,   0},
+         {254, 255,   0}},
+        {{170, 213, 255}, {171, 213, 255}, {171, 213, 255}, {171, 213, 255},
+         {170, 212, 255}, {169, 211, 255}, {167, 209, 255}, {165, 208, 255},
+         {163, 206, 255}, {161, 204, 255}, {158, 202, 255}, {155, 201, 255},
+         {153, 199, 255}, {151, 197, 255}, {148, 196, 255}, {147, 195, 255},
+         {145, 194, 255}, {144, 193, 255}, {143, 193, 255}, {143, 193, 255},
+         {143, 193, 255}, {144, 194, 255}, {146, 195, 255}, {148, 197, 255},
+         {151, 200, 255}, {156, 203, 255}, {161, 207, 255}, {168, 212, 255},
+         {176, 218, 255}, {185, 225, 255}, {196, 233, 255}, {208, 243, 255},
+         {223, 255, 255}, {228, 255, 242}, {233, 255, 228}, {238, 255, 213},
+         {243, 255, 197}, {248, 255, 180}, {253, 255, 162}, {255, 252, 141},
+         {255, 248, 117}, {255, 244,  93}, {255, 240,  64}, {255, 237,  21},
+         {255, 234,   0}, {255, 231,   0}, {255, 228,   0}, {255, 226,   0},
+         {255, 224,   0}, {255, 221,   0}, {255, 220,   0}, {255, 218,   0},
+         {255, 216,   0}, {255, 215,   0}, {255, 213,   0}, {255, 212,   0},
+         {255, 211,   0}, {255, 210,   0}, {255, 209,   0}, {255, 208,   0},
+         {255, 207,   0}, {255, 207,   0}, {255, 206,   0}, {255, 205,   0},
+         {255, 205,   0}}
+    },
+    {   // 2.0
+        {{255, 215,  54}, {255, 214,  53}, {255, 214,  53}, {255, 214,  54},
+         {255, 213,  54}, {255, 213,  54}, {255, 212,  54}, {255, 212,  55},
+         {255, 211,  55}, {255, 211,  56}, {255, 210,  57}, {255, 210,  57},
+         {255, 210,  58}, {255, 209,  58}, {255, 209,  59}, {255, 209,  59},
+         {255, 209,  59}, {255, 209,  60}, {255, 209,  60}, {255, 209,  60},
+         {255, 210,  60}, {255, 210,  60}, {255, 211,  59}, {255, 211,  58},
+         {255, 212,  58}, {255, 213,  57}, {255, 214,  55}, {255, 215,  54},
+         {255, 217,  52}, {255, 218,  50}, {255, 219,  48}, {255, 221,  45},
+         {255, 223,  42}, {255, 224,  39}, {255, 226,  36}, {255, 227,  32},
+         {255, 229,  28}, {255, 231,  23}, {255, 232,  17}, {255, 234,   9},
+         {255, 235,   0}, {255, 237,   0}, {255, 238,   0}, {255, 239,   0},
+         {255, 241,   0}, {255, 242,   0}, {255, 243,   0}, {255, 244,   0},
+         {255, 245,   0}, {255, 246,   0}, {255, 247,   0}, {255, 247,   0},
+         {255, 248,   0}, {255, 249,   0}, {255, 249,   0}, {255, 250,   0},
+         {255, 251,   0}, {255, 251,   0}, {255, 251,   0}, {255, 252,   0},
+         {255, 252,   0}, {255, 253,   0}, {255, 253,   0}, {255, 253,   0},
+         {255, 254,   0}},
+        {{166, 211, 255}, {167, 211, 255}, {168, 211, 255}, {168, 211, 255},
+         {167, 210, 255}, {166, 209, 255}, {164, 208, 255}, {162, 206, 255},
+         {160, 205, 255}, {158, 203, 255}, {156, 201, 255}, {154, 200, 255},
+         {151, 198, 255}, {149, 197, 255}, {147, 196, 255}, {146, 195, 255},
+         {144, 194, 255}, {143, 193, 255}, {143, 193, 255}, {143, 193, 255},
+         {143, 194, 255}, {145, 195, 255}, {146, 196, 255}, {149, 198, 255},
+         {153, 201, 255}, {157, 204, 255}, {163, 208, 255}, {169, 213, 255},
+         {177, 219, 255}, {187, 226, 255}, {198, 235, 255}, {210, 244, 255},
+         {224, 255, 254}, {229, 255, 241}, {234, 255, 227}, {239, 255, 212},
+         {244, 255, 197}, {248, 255, 180}, {253, 255, 162}, {255, 252, 142},
+         {255, 248, 119}, {255, 244,  95}, {255, 241,  68}, {255, 237,  31},
+         {255, 234,   0}, {255, 231,   0}, {255, 229,   0}, {255, 226,   0},
+         {255, 224,   0}, {255, 222,   0}, {255, 220,   0}, {255, 218,   0},
+         {255, 217,   0}, {255, 215,   0}, {255, 214,   0}, {255, 213,   0},
+         {255, 212,   0}, {255, 211,   0}, {255, 210,   0}, {255, 209,   0},
+         {255, 208,   0}, {255, 208,   0}, {255, 207,   0}, {255, 206,   0},
+         {255, 206,   0}}
+    },
+    {   // 2.1
+        {{255, 216,  64}, {255, 216,  64}, {255, 215,  64}, {255, 215,  64},
+         {255, 215,  64}, {255, 214,  64}, {255, 214,  65}, {255, 213,  65},
+         {255, 213,  66}, {255, 212,  66}, {255, 212,  67}, {255, 212,  68},
+         {255, 211,  68}, {255, 211,  69}, {255, 211,  69}, {255, 211,  70},
+         {255, 211,  70}, {255, 211,  70}, {255, 211,  70}, {255, 211,  70},
+         {255, 211,  70}, {255, 212,  70}, {255, 212,  69}, {255, 213,  68},
+         {255, 214,  67}, {255, 215,  66}, {255, 216,  65}, {255, 217,  63},
+         {255, 218,  61}, {255, 219,  58}, {255, 221,  56}, {255, 222,  53},
+         {255, 223,  50}, {255, 225,  46}, {255, 226,  43}, {255, 228,  38},
+         {255, 229,  34}, {255, 231,  29}, {255, 232,  23}, {255, 234,  15},
+         {255, 235,   0}, {255, 236,   0}, {255, 237,   0}, {255, 239,   0},
+         {255, 240,   0}, {255, 241,   0}, {255, 242,   0}, {255, 243,   0},
+         {255, 243,   0}, {255, 244,   0}, {255, 245,   0}, {255, 246,   0},
+         {255, 246,   0}, {255, 247,   0}, {255, 248,   0}, {255, 248,   0},
+         {255, 249,   0}, {255, 249,   0}, {255, 249,   0}, {255, 250,   0},
+         {255, 250,   0}, {255, 250,   0}, {255, 251,   0}, {255, 251,   0},
+         {255, 251,   0}},
+        {{164, 210, 255}, {166, 210, 255}, {166, 210, 255}, {166, 210, 255},
+         {165, 209, 255}, {164, 208, 255}, {163, 207, 255}, {161, 206, 255},
+         {160, 204, 255}, {158, 203, 255}, {156, 201, 255}, {154, 200, 255},
+         {152, 199, 255}, {150, 197, 255}, {148, 196, 255}, {147, 195, 255},
+         {146, 195, 255}, {145, 194, 255}, {145, 194, 255}, {145, 195, 255},
+         {146, 195, 255}, {147, 197, 255}, {150, 198, 255}, {152, 200, 255},
+         {156, 203, 255}, {161, 207, 255}, {167, 211, 255}, {173, 216, 255},
+         {182, 222, 255}, {191, 229, 255}, {202, 237, 255}, {215, 247, 255},
+         {226, 255, 251}, {231, 255, 238}, {235, 255, 225}, {240, 255, 210},
+         {245, 255, 195}, {249, 255, 179}, {254, 255, 162}, {255, 252, 142},
+         {255, 248, 120}, {255, 244,  97}, {255, 241,  72}, {255, 237,  39},
+         {255, 234,   0}, {255, 232,   0}, {255, 229,   0}, {255, 227,   0},
+         {255, 225,   0}, {255, 223,   0}, {255, 221,   0}, {255, 219,   0},
+         {255, 218,   0}, {255, 216,   0}, {255, 215,   0}, {255, 214,   0},
+         {255, 213,   0}, {255, 212,   0}, {255, 211,   0}, {255, 210,   0},
+         {255, 210,   0}, {255, 209,   0}, {255, 208,   0}, {255, 208,   0},
+         {255, 207,   0}}
+    },
+    {   // 2.2
+        {{255, 218,  73}, {255, 217,  73}, {255, 217,  73}, {255, 216,  73},
+         {255, 216,  73}, {255, 216,  73}, {255, 215,  74}, {255, 215,  74},
+         {255, 214,  75}, {255, 214,  75}, {255, 214,  76}, {255, 213,  76},
+         {255, 213,  77}, {255, 213,  77}, {255, 213,  78}, {255, 213,  78},
+         {255, 212,  79}, {255, 213,  79}, {255, 213,  79}, {255, 213,  79},
+         {255, 213,  78}, {255, 214,  78}, {255, 214,  77}, {255, 215,  76},
+         {255, 215,  75}, {255, 216,  74}, {255, 217,  72}, {255, 218,  70},
+         {255, 219,  68}, {255, 220,  65}, {255, 222,  62}, {255, 223,  59},
+         {255, 224,  56}, {255, 225,  52}, {255, 227,  48}, {255, 228,  43},
+         {255, 229,  38}, {255, 231,  33}, {255, 232,  27}, {255, 233,  19},
+         {255, 234,   7}, {255, 236,   0}, {255, 237,   0}, {255, 238,   0},
+         {255, 239,   0}, {255, 240,   0}, {255, 241,   0}, {255, 241,   0},
+         {255, 242,   0}, {255, 243,   0}, {255, 244,   0}, {255, 244,   0},
+         {255, 245,   0}, {255, 245,   0}, {255, 246,   0}, {255, 246,   0},
+         {255, 247,   0}, {255, 247,   0}, {255, 248,   0}, {255, 248,   0},
+         {255, 248,   0}, {255, 249,   0}, {255, 249,   0}, {255, 249,   0},
+         {255, 249,   0}},
+        {{163, 210, 255}, {165, 210, 255}, {165, 210, 255}, {165, 210, 255},
+         {165, 209, 255}, {164, 208, 255}, {163, 207, 255}, {162, 206, 255},
+         {160, 205, 255}, {158, 203, 255}, {157, 202, 255}, {155, 201, 255},
+         {153, 200, 255}, {152, 199, 255}, {151, 198, 255}, {150, 197, 255},
+         {149, 197, 255}, {148, 196, 255}, {148, 196, 255}, {149, 197, 255},
+         {150, 198, 255}, {152, 199, 255}, {154, 201, 255}, {157, 203, 255},
+         {161, 206, 255}, {166, 210, 255}, {172, 214, 255}, {179, 219, 255},
+         {187, 226, 255}, {197, 233, 255}, {208, 241, 255}, {221, 251, 255},
+         {228, 255, 247}, {233, 255, 235}, {237, 255, 221}, {242, 255, 207},
+         {246, 255, 193}, {251, 255, 177}, {255, 255, 160}, {255, 251, 141},
+         {255, 247, 120}, {255, 244,  98}, {255, 240,  74}, {255, 237,  45},
+         {255, 235,   0}, {255, 232,   0}, {255, 230,   0}, {255, 227,   0},
+         {255, 225,   0}, {255, 224,   0}, {255, 222,   0}, {255, 220,   0},
+         {255, 219,   0}, {255, 218,   0}, {255, 217,   0}, {255, 215,   0},
+         {255, 214,   0}, {255, 214,   0}, {255, 213,   0}, {255, 212,   0},
+         {255, 211,   0}, {255, 211,   0}, {255, 210,   0}, {255, 210,   0},
+         {255, 209,   0}}
+    },
+    {   // 2.3
+        {{255, 219,  81}, {255, 219,  81}, {255, 218,  81}, {255, 218,  81},
+         {255, 217,  81}, {255, 217,  81}, {255, 217,  81}, {255, 216,  82},
+         {255, 216,  82}, {255, 215,  83}, {255, 215,  84}, {255, 215,  84},
+         {255, 215,  85}, {255, 214,  85}, {255, 214,  86}, {255, 214,  86},
+         {255, 214,  86}, {255, 214,  86}, {255, 214,  86}, {255, 214,  86},
+         {255, 215,  85}, {255, 215,  85}, {255, 216,  84}, {255, 216,  83},
+         {255, 217,  82}, {255, 218,  80}, {255, 218,  78}, {255, 219,  76},
+         {255, 220,  73}, {255, 221,  71}, {255, 222,  68}, {255, 224,  64},
+         {255, 225,  60}, {255, 226,  56}, {255, 227,  52}, {255, 228,  47},
+         {255, 230,  42}, {255, 231,  36}, {255, 232,  30}, {255, 233,  22},
+         {255, 234,  11}, {255, 235,   0}, {255, 236,   0}, {255, 237,   0},
+         {255, 238,   0}, {255, 239,   0}, {255, 240,   0}, {255, 240,   0},
+         {255, 241,   0}, {255, 242,   0}, {255, 242,   0}, {255, 243,   0},
+         {255, 243,   0}, {255, 244,   0}, {255, 244,   0}, {255, 245,   0},
+         {255, 245,   0}, {255, 246,   0}, {255, 246,   0}, {255, 246,   0},
+         {255, 246,   0}, {255, 247,   0}, {255, 247,   0}, {255, 247,   0},
+         {255, 247,   0}},
+        {{163, 209, 255}, {164, 210, 255}, {165, 210, 255}, {165, 210, 255},
+         {165, 209, 255}, {164, 208, 255}, {164, 207, 255}, {163, 206, 255},
+         {161, 205, 255}, {160, 204, 255}, {159, 203, 255}, {157, 202, 255},
+         {156, 201, 255}, {155, 200, 255}, {154, 200, 255}, {153, 199, 255},
+         {152, 199, 255}, {152, 199, 255}, {153, 199, 255}, {154, 200, 255},
+         {155, 201, 255}, {157, 202, 255}, {160, 204, 255}, {163, 207, 255},
+         {167, 210, 255}, {172, 214, 255}, {179, 218, 255}, {186, 224, 255},
+         {194, 230, 255}, {204, 237, 255}, {215, 246, 255}, {227, 255, 254},
+         {231, 255, 242}, {235, 255, 230}, {240, 255, 217}, {244, 255, 204},
+         {248, 255, 189}, {252, 255, 174}, {255, 254, 158}, {255, 250, 139},
+         {255, 246, 119}, {255, 243,  99}, {255, 240,  76}, {255, 237,  49},
+         {255, 235,   0}, {255, 232,   0}, {255, 230,   0}, {255, 228,   0},
+         {255, 226,   0}, {255, 224,   0}, {255, 223,   0}, {255, 221,   0},
+         {255, 220,   0}, {255, 219,   0}, {255, 218,   0}, {255, 217,   0},
+         {255, 216,   0}, {255, 215,   0}, {255, 214,   0}, {255, 214,   0},
+         {255, 213,   0}, {255, 213,   0}, {255, 212,   0}, {255, 212,   0},
+         {255, 211,   0}}
+    },
+    {   // 2.4
+        {{255, 221,  88}, {255, 220,  88}, {255, 220,  88}, {255, 219,  88},
+         {255, 219,  88}, {255, 218,  88}, {255, 218,  88}, {255, 217,  89},
+         {255, 217,  89}, {255, 217,  90}, {255, 216,  90}, {255, 216,  91},
+         {255, 216,  91}, {255, 216,  92}, {255, 216,  92}, {255, 216,  92},
+         {255, 216,  92}, {255, 216,  92}, {255, 216,  92}, {255, 216,  92},
+         {255, 216,  91}, {255, 217,  91}, {255, 217,  90}, {255, 218,  88},
+         {255, 218,  87}, {255, 219,  85}, {255, 220,  83}, {255, 220,  81},
+         {255, 221,  78}, {255, 222,  75}, {255, 223,  72}, {255, 224,  68},
+         {255, 225,  64}, {255, 226,  60}, {255, 227,  55}, {255, 228,  50},
+         {255, 230,  45}, {255, 231,  39}, {255, 232,  32}, {255, 233,  25},
+         {255, 234,  14}, {255, 235,   0}, {255, 235,   0}, {255, 236,   0},
+         {255, 237,   0}, {255, 238,   0}, {255, 239,   0}, {255, 239,   0},
+         {255, 240,   0}, {255, 240,   0}, {255, 241,   0}, {255, 242,   0},
+         {255, 242,   0}, {255, 243,   0}, {255, 243,   0}, {255, 243,   0},
+         {255, 244,   0}, {255, 244,   0}, {255, 244,   0}, {255, 245,   0},
+         {255, 245,   0}, {255, 245,   0}, {255, 245,   0}, {255, 246,   0},
+         {255, 246,   0}},
+        {{162, 209, 255}, {164, 210, 255}, {165, 210, 255}, {165, 210, 255},
+         {165, 209, 255}, {165, 209, 255}, {165, 208, 255}, {164, 207, 255},
+         {163, 206, 255}, {162, 205, 255}, {161, 205, 255}, {160, 204, 255},
+         {159, 203, 255}, {158, 202, 255}, {157, 202, 255}, {157, 201, 255},
+         {157, 201, 255}, {157, 202, 255}, {158, 202, 255}, {159, 203, 255},
+         {161, 204, 255}, {163, 206, 255}, {166, 208, 255}, {170, 211, 255},
+         {174, 214, 255}, {180, 218, 255}, {186, 223, 255}, {194, 229, 255},
+         {202, 235, 255}, {212, 243, 255}, {224, 252, 255}, {230, 255, 248},
+         {234, 255, 237}, {238, 255, 225}, {242, 255, 212}, {246, 255, 199},
+         {250, 255, 186}, {254, 255, 171}, {255, 252, 154}, {255, 249, 136},
+         {255, 246, 118}, {255, 243,  98}, {255, 240,  77}, {255, 237,  53},
+         {255, 235,  15}, {255, 233,   0}, {255, 230,   0}, {255, 229,   0},
+         {255, 227,   0}, {255, 225,   0}, {255, 224,   0}, {255, 223,   0},
+         {255, 221,   0}, {255, 220,   0}, {255, 219,   0}, {255, 218,   0},
+         {255, 218,   0}, {255, 217,   0}, {255, 216,   0}, {255, 216,   0},
+         {255, 215,   0}, {255, 214,   0}, {255, 214,   0}, {255, 214,   0},
+         {255, 213,   0}}
+    },
+    {   // 2.5
+        {{255, 222,  95}, {255, 222,  95}, {255, 221,  95}, {255, 221,  94},
+         {255, 220,  94}, {255, 220,  95}, {255, 219,  95}, {255, 219,  95},
+         {255, 218,  96}, {255, 218,  96}, {255, 218,  96}, {255, 217,  97},
+         {255, 217,  97}, {255, 217,  98}, {255, 217,  98}, {255, 217,  98},
+         {255, 217,  98}, {255, 217,  98}, {255, 217,  97}, {255, 217,  97},
+         {255, 217,  96}, {255, 218,  95}, {255, 218,  94}, {255, 219,  93},
+         {255, 219,  91}, {255, 220,  89}, {255, 220,  87}, {255, 221,  84},
+         {255, 222,  81}, {255, 223,  78}, {255, 224,  75}, {255, 225,  71},
+         {255, 226,  67}, {255, 227,  63}, {255, 228,  58}, {255, 229,  53},
+         {255, 229,  47}, {255, 230,  41}, {255, 231,  35}, {255, 232,  27},
+         {255, 233,  17}, {255, 234,   0}, {255, 235,   0}, {255, 236,   0},
+         {255, 236,   0}, {255, 237,   0}, {255, 238,   0}, {255, 238,   0},
+         {255, 239,   0}, {255, 239,   0}, {255, 240,   0}, {255, 240,   0},
+         {255, 241,   0}, {255, 241,   0}, {255, 242,   0}, {255, 242,   0},
+         {255, 242,   0}, {255, 243,   0}, {255, 243,   0}, {255, 243,   0},
+         {255, 244,   0}, {255, 244,   0}, {255, 244,   0}, {255, 244,   0},
+         {255, 244,   0}},
+        {{162, 209, 255}, {164, 210, 255}, {165, 210, 255}, {166, 210, 255},
+         {166, 210, 255}, {166, 210, 255}, {166, 209, 255}, {166, 208, 255},
+         {165, 208, 255}, {165, 207, 255}, {164, 206, 255}, {163, 206, 255},
+         {163, 205, 255}, {162, 205, 255}, {162, 204, 255}, {162, 204, 255},
+         {162, 204, 255}, {163, 205, 255}, {164, 206, 255}, {166, 207, 255},
+         {168, 208, 255}, {170, 210, 255}, {174, 213, 255}, {178, 216, 255},
+         {183, 219, 255}, {188, 223, 255}, {195, 228, 255}, {203, 234, 255},
+         {212, 241, 255}, {222, 249, 255}, {231, 255, 251}, {234, 255, 241},
+         {238, 255, 231}, {242, 255, 219}, {245, 255, 207}, {249, 255, 194},
+         {253, 255, 181}, {255, 254, 166}, {255, 251, 150}, {255, 247, 133},
+         {255, 245, 116}, {255, 242,  97}, {255, 239,  78}, {255, 237,  55},
+         {255, 235,  24}, {255, 233,   0}, {255, 231,   0}, {255, 229,   0},
+         {255, 228,   0}, {255, 226,   0}, {255, 225,   0}, {255, 224,   0},
+         {255, 223,   0}, {255, 222,   0}, {255, 221,   0}, {255, 220,   0},
+         {255, 219,   0}, {255, 218,   0}, {255, 218,   0}, {255, 217,   0},
+         {255, 217,   0}, {255, 216,   0}, {255, 216,   0}, {255, 216,   0},
+         {255, 215,   0}}
+    },
+    {   // 2.6
+        {{255, 224, 102}, {255, 223, 101}, {255, 222, 101}, {255, 222, 101},
+         {255, 221, 101}, {255, 221, 101}, {255, 220, 101}, {255, 220, 101},
+         {255, 220, 101}, {255, 219, 102}, {255, 219, 102}, {255, 219, 102},
+         {255, 218, 102}, {255, 218, 103}, {255, 218, 103}, {255, 218, 103},
+         {255, 218, 103}, {255, 218, 102}, {255, 218, 102}, {255, 218, 101},
+         {255, 219, 100}, {255, 219,  99}, {255, 219,  98}, {255, 220,  96},
+         {255, 220,  94}, {255, 221,  92}, {255, 221,  90}, {255, 222,  87},
+         {255, 223,  84}, {255, 223,  81}, {255, 224,  77}, {255, 225,  73},
+         {255, 226,  69}, {255, 227,  65}, {255, 228,  60}, {255, 228,  55},
+         {255, 229,  49}, {255, 230,  43}, {255, 231,  36}, {255, 232,  28},
+         {255, 233,  19}, {255, 233,   0}, {255, 234,   0}, {255, 235,   0},
+         {255, 236,   0}, {255, 236,   0}, {255, 237,   0}, {255, 237,   0},
+         {255, 238,   0}, {255, 238,   0}, {255, 239,   0}, {255, 239,   0},
+         {255, 240,   0}, {255, 240,   0}, {255, 240,   0}, {255, 241,   0},
+         {255, 241,   0}, {255, 241,   0}, {255, 242,   0}, {255, 242,   0},
+         {255, 242,   0}, {255, 242,   0}, {255, 243,   0}, {255, 243,   0},
+         {255, 243,   0}},
+        {{162, 209, 255}, {164, 210, 255}, {166, 211, 255}, {167, 211, 255},
+         {168, 211, 255}, {168, 211, 255}, {168, 210, 255}, {168, 210, 255},
+         {168, 209, 255}, {168, 209, 255}, {168, 208, 255}, {167, 208, 255},
+         {167, 208, 255}, {167, 208, 255}, {167, 208, 255}, {168, 208, 255},
+         {168, 208, 255}, {169, 209, 255}, {171, 210, 255}, {173, 211, 255},
+         {175, 213, 255}, {178, 215, 255}, {182, 218, 255}, {187, 221, 255},
+         {192, 225, 255}, {198, 229, 255}, {205, 235, 255}, {213, 241, 255},
+         {222, 248, 255}, {232, 255, 253}, {235, 255, 244}, {238, 255, 234},
+         {242, 255, 224}, {245, 255, 213}, {248, 255, 201}, {252, 255, 189},
+         {255, 255, 176}, {255, 252, 161}, {255, 249, 145}, {255, 246, 129},
+         {255, 243, 113}, {255, 241,  96}, {255, 239,  78}, {255, 237,  57},
+         {255, 235,  31}, {255, 233,   0}, {255, 231,   0}, {255, 230,   0},
+         {255, 228,   0}, {255, 227,   0}, {255, 226,   0}, {255, 225,   0},
+         {255, 224,   0}, {255, 223,   0}, {255, 222,   0}, {255, 221,   0},
+         {255, 221,   0}, {255, 220,   0}, {255, 220,   0}, {255, 219,   0},
+         {255, 219,   0}, {255, 218,   0}, {255, 218,   0}, {255, 218,   0},
+         {255, 217,   0}}
+    },
+    {   // 2.7
+        {{255, 225, 108}, {255, 224, 107}, {255, 224, 107}, {255, 223, 106},
+         {255, 222, 106}, {255, 222, 106}, {255, 221, 106}, {255, 221, 106},
+         {255, 221, 106}, {255, 220, 106}, {255, 220, 107}, {255, 220, 107},
+         {255, 219, 107}, {255, 219, 107}, {255, 219, 107}, {255, 219, 107},
+         {255, 219, 106}, {255, 219, 106}, {255, 219, 105}, {255, 219, 104},
+         {255, 219, 103}, {255, 220, 102}, {255, 220, 100}, {255, 220,  99},
+         {255, 221,  97}, {255, 221,  94}, {255, 222,  92}, {255, 222,  89},
+         {255, 223,  86}, {255, 224,  82}, {255, 224,  79}, {255, 225,  75},
+         {255, 226,  70}, {255, 227,  66}, {255, 227,  61}, {255, 228,  56},
+         {255, 229,  50}, {255, 230,  44}, {255, 231,  37}, {255, 231,  29},
+         {255, 232,  20}, {255, 233,   3}, {255, 233,   0}, {255, 234,   0},
+         {255, 235,   0}, {255, 235,   0}, {255, 236,   0}, {255, 236,   0},
+         {255, 237,   0}, {255, 237,   0}, {255, 238,   0}, {255, 238,   0},
+         {255, 239,   0}, {255, 239,   0}, {255, 239,   0}, {255, 240,   0},
+         {255, 240,   0}, {255, 240,   0}, {255, 241,   0}, {255, 241,   0},
+         {255, 241,   0}, {255, 241,   0}, {255, 242,   0}, {255, 242,   0},
+         {255, 242,   0}},
+        {{162, 209, 255}, {165, 210, 255}, {166, 211, 255}, {168, 211, 255},
+         {169, 212, 255}, {170, 212, 255}, {171, 212, 255}, {171, 212, 255},
+         {171, 211, 255}, {171, 211, 255}, {172, 211, 255}, {172, 211, 255},
+         {172, 211, 255}, {173, 211, 255}, {173, 211, 255}, {174, 212, 255},
+         {175, 212, 255}, {177, 213, 255}, {179, 214, 255}, {181, 216, 255},
+         {184, 218, 255}, {188, 221, 255}, {192, 224, 255}, {197, 227, 255},
+         {202, 231, 255}, {209, 236, 255}, {216, 242, 255}, {225, 249, 255},
+         {233, 255, 254}, {236, 255, 245}, {239, 255, 236}, {242, 255, 227},
+         {245, 255, 216}, {249, 255, 206}, {252, 255, 194}, {255, 255, 183},
+         {255, 252, 169}, {255, 250, 154}, {255, 247, 140}, {255, 244, 125},
+         {255, 242, 110}, {255, 240,  94}, {255, 238,  77}, {255, 236,  58},
+         {255, 234,  35}, {255, 233,   0}, {255, 231,   0}, {255, 230,   0},
+         {255, 229,   0}, {255, 228,   0}, {255, 227,   0}, {255, 226,   0},
+         {255, 225,   0}, {255, 224,   0}, {255, 223,   0}, {255, 223,   0},
+         {255, 222,   0}, {255, 222,   0}, {255, 221,   0}, {255, 221,   0},
+         {255, 220,   0}, {255, 220,   0}, {255, 220,   0}, {255, 220,   0},
+         {255, 219,   0}}
+    },
+    {   // 2.8
+        {{255, 226, 114}, {255, 225, 113}, {255, 225, 112}, {255, 224, 112},
+         {255, 224, 111}, {255, 223, 111}, {255, 223, 111}, {255, 222, 111},
+         {255, 222, 111}, {255, 221, 111}, {255, 221, 111}, {255, 221, 111},
+         {255, 220, 110}, {255, 220, 110}, {255, 220, 110}, {255, 220, 110},
+         {255, 220, 109}, {255, 220, 108}, {255, 220, 108}, {255, 220, 107},
+         {255, 220, 105}, {255, 220, 104}, {255, 221, 102}, {255, 221, 100},
+         {255, 221,  98}, {255, 222,  96}, {255, 222,  93}, {255, 223,  90},
+         {255, 223,  87}, {255, 224,  83}, {255, 224,  79}, {255, 225,  75},
+         {255, 226,  71}, {255, 227,  66}, {255, 227,  61}, {255, 228,  56},
+         {255, 229,  50}, {255, 229,  44}, {255, 230,  38}, {255, 231,  30},
+         {255, 232,  21}, {255, 232,   6}, {255, 233,   0}, {255, 233,   0},
+         {255, 234,   0}, {255, 235,   0}, {255, 235,   0}, {255, 236,   0},
+         {255, 236,   0}, {255, 237,   0}, {255, 237,   0}, {255, 237,   0},
+         {255, 238,   0}, {255, 238,   0}, {255, 238,   0}, {255, 239,   0},
+         {255, 239,   0}, {255, 239,   0}, {255, 240,   0}, {255, 240,   0},
+         {255, 240,   0}, {255, 240,   0}, {255, 241,   0}, {255, 241,   0},
+         {255, 241,   0}},
+        {{162, 210, 255}, {165, 211, 255}, {167, 212, 255}, {169, 212, 255},
+         {171, 213, 255}, {172, 213, 255}, {173, 213, 255}, {174, 214, 255},
+         {175, 214, 255}, {176, 214, 255}, {177, 214, 255}, {177, 214, 255},
+         {178, 214, 255}, {179, 215, 255}, {180, 215, 255}, {182, 216, 255},
+         {183, 217, 255}, {185, 218, 255}, {188, 220, 255}, {191, 222, 255},
+         {194, 224, 255}, {198, 227, 255}, {203, 230, 255}, {208, 234, 255},
+         {214, 239, 255}, {221, 244, 255}, {229, 251, 255}, {236, 255, 252},
+         {238, 255, 245}, {241, 255, 236}, {244, 255, 228}, {247, 255, 218},
+         {249, 255, 208}, {252, 255, 198}, {255, 255, 187}, {255, 252, 174},
+         {255, 250, 161}, {255, 247, 147}, {255, 245, 134}, {255, 243, 120},
+         {255, 241, 106}, {255, 239,  91}, {255, 237,  76}, {255, 235,  59},
+         {255, 234,  38}, {255, 233,   0}, {255, 231,   0}, {255, 230,   0},
+         {255, 229,   0}, {255, 228,   0}, {255, 227,   0}, {255, 226,   0},
+         {255, 226,   0}, {255, 225,   0}, {255, 224,   0}, {255, 224,   0},
+         {255, 223,   0}, {255, 223,   0}, {255, 223,   0}, {255, 222,   0},
+         {255, 222,   0}, {255, 222,   0}, {255, 222,   0}, {255, 221,   0},
+         {255, 221,   0}}
+    },
+    {   // 2.9
+        {{255, 228, 120}, {255, 227, 118}, {255, 226, 117}, {255, 225, 117},
+         {255, 225, 116}, {255, 224, 116}, {255, 223, 115}, {255, 223, 115},
+         {255, 223, 115}, {255, 222, 114}, {255, 222, 114}, {255, 221, 114},
+         {255, 221, 113}, {255, 221, 113}, {255, 221, 113}, {255, 221, 112},
+         {255, 220, 111}, {255, 220, 110}, {255, 220, 109}, {255, 220, 108},
+         {255, 221, 107}, {255, 221, 105}, {255, 221, 103}, {255, 221, 101},
+         {255, 221,  99}, {255, 222,  96}, {255, 222,  93}, {255, 223,  90},
+         {255, 223,  87}, {255, 224,  83}, {255, 224,  79}, {255, 225,  75},
+         {255, 226,  71}, {255, 226,  66}, {255, 227,  61}, {255, 228,  56},
+         {255, 228,  50}, {255, 229,  44}, {255, 230,  38}, {255, 230,  30},
+         {255, 231,  22}, {255, 232,   8}, {255, 232,   0}, {255, 233,   0},
+         {255, 233,   0}, {255, 234,   0}, {255, 234,   0}, {255, 235,   0},
+         {255, 235,   0}, {255, 236,   0}, {255, 236,   0}, {255, 237,   0},
+         {255, 237,   0}, {255, 237,   0}, {255, 238,   0}, {255, 238,   0},
+         {255, 238,   0}, {255, 238,   0}, {255, 239,   0}, {255, 239,   0},
+         {255, 239,   0}, {255, 239,   0}, {255, 240,   0}, {255, 240,   0},
+         {255, 240,   0}},
+        {{162, 210, 255}, {166, 211, 255}, {169, 212, 255}, {171, 213, 255},
+         {173, 214, 255}, {175, 215, 255}, {177, 215, 255}, {178, 216, 255},
+         {180, 216, 255}, {181, 217, 255}, {182, 217, 255}, {184, 218, 255},
+         {185, 218, 255}, {187, 219, 255}, {188, 220, 255}, {190, 221, 255},
+         {192, 223, 255}, {195, 224, 255}, {198, 226, 255}, {201, 229, 255},
+         {205, 231, 255}, {210, 235, 255}, {215, 238, 255}, {221, 243, 255},
+         {228, 248, 255}, {235, 254, 255}, {239, 255, 250}, {241, 255, 243},
+         {243, 255, 235}, {246, 255, 227}, {249, 255, 218}, {251, 255, 209},
+         {254, 255, 200}, {255, 254, 189}, {255, 251, 177}, {255, 249, 165},
+         {255, 247, 152}, {255, 245, 140}, {255, 243, 127}, {255, 241, 115},
+         {255, 239, 102}, {255, 238,  88}, {255, 236,  74}, {255, 235,  58},
+         {255, 234,  40}, {255, 232,  12}, {255, 231,   0}, {255, 230,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 228,   0}, {255, 227,   0},
+         {255, 227,   0}, {255, 226,   0}, {255, 226,   0}, {255, 225,   0},
+         {255, 225,   0}, {255, 224,   0}, {255, 224,   0}, {255, 224,   0},
+         {255, 224,   0}, {255, 223,   0}, {255, 223,   0}, {255, 223,   0},
+         {255, 223,   0}}
+    },
+    {   // 3.0
+        {{255, 229, 125}, {255, 228, 123}, {255, 227, 122}, {255, 226, 121},
+         {255, 226, 120}, {255, 225, 119}, {255, 224, 119}, {255, 224, 118},
+         {255, 223, 118}, {255, 223, 117}, {255, 222, 117}, {255, 222, 116},
+         {255, 222, 116}, {255, 221, 115}, {255, 221, 114}, {255, 221, 113},
+         {255, 221, 112}, {255, 221, 111}, {255, 221, 110}, {255, 221, 108},
+         {255, 221, 107}, {255, 221, 105}, {255, 221, 103}, {255, 221, 101},
+         {255, 222,  98}, {255, 222,  95}, {255, 222,  93}, {255, 223,  89},
+         {255, 223,  86}, {255, 224,  82}, {255, 224,  78}, {255, 225,  74},
+         {255, 225,  70}, {255, 226,  65}, {255, 227,  60}, {255, 227,  55},
+         {255, 228,  50}, {255, 228,  44}, {255, 229,  37}, {255, 230,  30},
+         {255, 230,  22}, {255, 231,  10}, {255, 231,   0}, {255, 232,   0},
+         {255, 233,   0}, {255, 233,   0}, {255, 234,   0}, {255, 234,   0},
+         {255, 235,   0}, {255, 235,   0}, {255, 235,   0}, {255, 236,   0},
+         {255, 236,   0}, {255, 236,   0}, {255, 237,   0}, {255, 237,   0},
+         {255, 237,   0}, {255, 238,   0}, {255, 238,   0}, {255, 238,   0},
+         {255, 238,   0}, {255, 239,   0}, {255, 239,   0}, {255, 239,   0},
+         {255, 239,   0}},
+        {{163, 210, 255}, {167, 212, 255}, {170, 213, 255}, {173, 215, 255},
+         {176, 216, 255}, {178, 217, 255}, {181, 218, 255}, {183, 219, 255},
+         {185, 220, 255}, {187, 220, 255}, {189, 221, 255}, {191, 222, 255},
+         {193, 223, 255}, {195, 224, 255}, {197, 226, 255}, {200, 227, 255},
+         {203, 229, 255}, {206, 231, 255}, {210, 234, 255}, {214, 236, 255},
+         {218, 240, 255}, {223, 243, 255}, {229, 248, 255}, {236, 253, 255},
+         {240, 255, 252}, {242, 255, 246}, {244, 255, 239}, {247, 255, 232},
+         {249, 255, 225}, {251, 255, 217}, {253, 255, 208}, {255, 254, 199},
+         {255, 252, 188}, {255, 250, 177}, {255, 248, 166}, {255, 246, 155},
+         {255, 244, 144}, {255, 242, 132}, {255, 241, 121}, {255, 239, 109},
+         {255, 238,  97}, {255, 236,  84}, {255, 235,  71}, {255, 234,  57},
+         {255, 233,  41}, {255, 232,  19}, {255, 231,   0}, {255, 230,   0},
+         {255, 230,   0}, {255, 229,   0}, {255, 228,   0}, {255, 228,   0},
+         {255, 227,   0}, {255, 227,   0}, {255, 227,   0}, {255, 226,   0},
+         {255, 226,   0}, {255, 226,   0}, {255, 225,   0}, {255, 225,   0},
+         {255, 225,   0}, {255, 225,   0}, {255, 225,   0}, {255, 225,   0},
+         {255, 225,   0}}
+    },
+    {   // 3.1
+        {{255, 230, 130}, {255, 229, 128}, {255, 228, 127}, {255, 227, 125},
+         {255, 226, 124}, {255, 226, 123}, {255, 225, 122}, {255, 224, 121},
+         {255, 224, 120}, {255, 223, 119}, {255, 223, 118}, {255, 222, 118},
+         {255, 222, 117}, {255, 222, 116}, {255, 221, 115}, {255, 221, 114},
+         {255, 221, 112}, {255, 221, 111}, {255, 221, 110}, {255, 221, 108},
+         {255, 221, 106}, {255, 221, 104}, {255, 221, 102}, {255, 221,  99},
+         {255, 221,  97}, {255, 222,  94}, {255, 222,  91}, {255, 222,  88},
+         {255, 223,  84}, {255, 223,  81}, {255, 224,  77}, {255, 224,  73},
+         {255, 225,  68}, {255, 225,  64}, {255, 226,  59}, {255, 227,  54},
+         {255, 227,  49}, {255, 228,  43}, {255, 228,  37}, {255, 229,  30},
+         {255, 230,  22}, {255, 230,  10}, {255, 231,   0}, {255, 231,   0},
+         {255, 232,   0}, {255, 232,   0}, {255, 233,   0}, {255, 233,   0},
+         {255, 234,   0}, {255, 234,   0}, {255, 235,   0}, {255, 235,   0},
+         {255, 235,   0}, {255, 236,   0}, {255, 236,   0}, {255, 236,   0},
+         {255, 237,   0}, {255, 237,   0}, {255, 237,   0}, {255, 237,   0},
+         {255, 238,   0}, {255, 238,   0}, {255, 238,   0}, {255, 238,   0},
+         {255, 238,   0}},
+        {{163, 210, 255}, {168, 212, 255}, {172, 214, 255}, {176, 216, 255},
+         {179, 218, 255}, {182, 219, 255}, {185, 221, 255}, {188, 222, 255},
+         {191, 223, 255}, {194, 225, 255}, {196, 226, 255}, {199, 227, 255},
+         {202, 229, 255}, {205, 230, 255}, {208, 232, 255}, {211, 234, 255},
+         {215, 237, 255}, {219, 239, 255}, {223, 242, 255}, {228, 246, 255},
+         {233, 249, 255}, {239, 254, 255}, {242, 255, 252}, {244, 255, 246},
+         {246, 255, 241}, {248, 255, 235}, {250, 255, 228}, {252, 255, 221},
+         {254, 255, 214}, {255, 254, 205}, {255, 252, 195}, {255, 250, 185},
+         {255, 248, 175}, {255, 246, 165}, {255, 245, 155}, {255, 243, 145},
+         {255, 241, 134}, {255, 240, 124}, {255, 239, 113}, {255, 237, 103},
+         {255, 236,  92}, {255, 235,  80}, {255, 234,  68}, {255, 233,  56},
+         {255, 232,  41}, {255, 232,  22}, {255, 231,   0}, {255, 230,   0},
+         {255, 230,   0}, {255, 229,   0}, {255, 229,   0}, {255, 228,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 227,   0}, {255, 227,   0},
+         {255, 227,   0}, {255, 227,   0}, {255, 226,   0}, {255, 226,   0},
+         {255, 226,   0}, {255, 226,   0}, {255, 226,   0}, {255, 226,   0},
+         {255, 226,   0}}
+    },
+    {   // 3.2
+        {{255, 231, 135}, {255, 230, 133}, {255, 229, 131}, {255, 228, 129},
+         {255, 227, 127}, {255, 226, 126}, {255, 225, 124}, {255, 225, 123},
+         {255, 224, 122}, {255, 224, 121}, {255, 223, 119}, {255, 222, 118},
+         {255, 222, 117}, {255, 222, 116}, {255, 221, 115}, {255, 221, 113},
+         {255, 221, 112}, {255, 221, 110}, {255, 221, 108}, {255, 220, 106},
+         {255, 220, 104}, {255, 221, 102}, {255, 221, 100}, {255, 221,  97},
+         {255, 221,  95}, {255, 221,  92}, {255, 222,  89}, {255, 222,  85},
+         {255, 222,  82}, {255, 223,  78}, {255, 223,  74}, {255, 224,  70},
+         {255, 224,  66}, {255, 225,  62}, {255, 225,  57}, {255, 226,  52},
+         {255, 227,  47}, {255, 227,  41}, {255, 228,  35}, {255, 228,  29},
+         {255, 229,  21}, {255, 230,  11}, {255, 230,   0}, {255, 231,   0},
+         {255, 231,   0}, {255, 232,   0}, {255, 232,   0}, {255, 233,   0},
+         {255, 233,   0}, {255, 233,   0}, {255, 234,   0}, {255, 234,   0},
+         {255, 235,   0}, {255, 235,   0}, {255, 235,   0}, {255, 236,   0},
+         {255, 236,   0}, {255, 236,   0}, {255, 236,   0}, {255, 237,   0},
+         {255, 237,   0}, {255, 237,   0}, {255, 237,   0}, {255, 237,   0},
+         {255, 237,   0}},
+        {{163, 210, 255}, {169, 213, 255}, {174, 216, 255}, {178, 218, 255},
+         {183, 220, 255}, {187, 222, 255}, {191, 224, 255}, {195, 226, 255},
+         {198, 228, 255}, {202, 230, 255}, {205, 232, 255}, {209, 233, 255},
+         {213, 236, 255}, {216, 238, 255}, {220, 240, 255}, {224, 243, 255},
+         {229, 246, 255}, {234, 249, 255}, {239, 252, 255}, {243, 255, 254},
+         {245, 255, 249}, {247, 255, 245}, {249, 255, 240}, {250, 255, 234},
+         {252, 255, 229}, {254, 255, 222}, {255, 254, 215}, {255, 252, 207},
+         {255, 250, 198}, {255, 249, 189}, {255, 247, 181}, {255, 245, 172},
+         {255, 244, 162}, {255, 243, 153}, {255, 241, 144}, {255, 240, 134},
+         {255, 239, 125}, {255, 238, 115}, {255, 237, 106}, {255, 236,  96},
+         {255, 235,  86}, {255, 234,  75}, {255, 233,  65}, {255, 232,  53},
+         {255, 232,  40}, {255, 231,  24}, {255, 231,   0}, {255, 230,   0},
+         {255, 230,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 228,   0}, {255, 228,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 227,   0}, {255, 227,   0},
+         {255, 227,   0}, {255, 227,   0}, {255, 227,   0}, {255, 227,   0},
+         {255, 227,   0}}
+    },
+    {   // 3.3
+        {{255, 232, 140}, {255, 231, 137}, {255, 230, 134}, {255, 229, 132},
+         {255, 228, 130}, {255, 227, 128}, {255, 226, 126}, {255, 225, 124},
+         {255, 224, 123}, {255, 224, 121}, {255, 223, 119}, {255, 222, 118},
+         {255, 222, 116}, {255, 221, 115}, {255, 221, 113}, {255, 221, 112},
+         {255, 220, 110}, {255, 220, 108}, {255, 220, 106}, {255, 220, 104},
+         {255, 220, 102}, {255, 220,  99}, {255, 220,  97}, {255, 220,  94},
+         {255, 220,  91}, {255, 221,  88}, {255, 221,  85}, {255, 221,  82},
+         {255, 222,  79}, {255, 222,  75}, {255, 223,  71}, {255, 223,  67},
+         {255, 224,  63}, {255, 224,  59}, {255, 225,  54}, {255, 225,  50},
+         {255, 226,  45}, {255, 227,  39}, {255, 227,  34}, {255, 228,  27},
+         {255, 228,  20}, {255, 229,  10}, {255, 229,   0}, {255, 230,   0},
+         {255, 230,   0}, {255, 231,   0}, {255, 231,   0}, {255, 232,   0},
+         {255, 232,   0}, {255, 233,   0}, {255, 233,   0}, {255, 234,   0},
+         {255, 234,   0}, {255, 234,   0}, {255, 235,   0}, {255, 235,   0},
+         {255, 235,   0}, {255, 235,   0}, {255, 236,   0}, {255, 236,   0},
+         {255, 236,   0}, {255, 236,   0}, {255, 236,   0}, {255, 237,   0},
+         {255, 237,   0}},
+        {{163, 211, 255}, {170, 214, 255}, {176, 217, 255}, {182, 220, 255},
+         {187, 223, 255}, {193, 225, 255}, {198, 228, 255}, {202, 231, 255},
+         {207, 233, 255}, {212, 236, 255}, {216, 238, 255}, {221, 241, 255},
+         {225, 244, 255}, {230, 246, 255}, {235, 250, 255}, {240, 253, 255},
+         {244, 255, 254}, {246, 255, 250}, {248, 255, 246}, {250, 255, 241},
+         {252, 255, 237}, {253, 255, 232}, {255, 255, 227}, {255, 253, 220},
+         {255, 251, 212}, {255, 250, 205}, {255, 248, 197}, {255, 247, 190},
+         {255, 245, 182}, {255, 244, 174}, {255, 243, 166}, {255, 241, 157},
+         {255, 240, 149}, {255, 239, 141}, {255, 238, 132}, {255, 237, 124},
+         {255, 236, 115}, {255, 235, 106}, {255, 234,  98}, {255, 234,  89},
+         {255, 233,  80}, {255, 232,  70}, {255, 232,  61}, {255, 231,  50},
+         {255, 231,  39}, {255, 231,  25}, {255, 230,   0}, {255, 230,   0},
+         {255, 230,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 228,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 228,   0}, {255, 228,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 228,   0}, {255, 228,   0},
+         {255, 228,   0}}
+    },
+    {   // 3.4
+        {{255, 233, 144}, {255, 232, 141}, {255, 230, 137}, {255, 229, 134},
+         {255, 228, 132}, {255, 227, 129}, {255, 226, 127}, {255, 225, 124},
+         {255, 224, 122}, {255, 223, 120}, {255, 223, 118}, {255, 222, 117},
+         {255, 221, 115}, {255, 221, 113}, {255, 221, 111}, {255, 220, 109},
+         {255, 220, 107}, {255, 220, 105}, {255, 219, 103}, {255, 219, 100},
+         {255, 219,  98}, {255, 219,  95}, {255, 219,  93}, {255, 219,  90},
+         {255, 220,  87}, {255, 220,  84}, {255, 220,  81}, {255, 221,  78},
+         {255, 221,  74}, {255, 221,  71}, {255, 222,  67}, {255, 222,  63},
+         {255, 223,  59}, {255, 223,  55}, {255, 224,  51}, {255, 225,  46},
+         {255, 225,  42}, {255, 226,  37}, {255, 226,  31}, {255, 227,  26},
+         {255, 228,  19}, {255, 228,   9}, {255, 229,   0}, {255, 229,   0},
+         {255, 230,   0}, {255, 230,   0}, {255, 231,   0}, {255, 231,   0},
+         {255, 232,   0}, {255, 232,   0}, {255, 232,   0}, {255, 233,   0},
+         {255, 233,   0}, {255, 234,   0}, {255, 234,   0}, {255, 234,   0},
+         {255, 234,   0}, {255, 235,   0}, {255, 235,   0}, {255, 235,   0},
+         {255, 235,   0}, {255, 235,   0}, {255, 236,   0}, {255, 236,   0},
+         {255, 236,   0}},
+        {{164, 211, 255}, {172, 215, 255}, {179, 219, 255}, {186, 223, 255},
+         {193, 226, 255}, {199, 230, 255}, {206, 233, 255}, {212, 236, 255},
+         {218, 240, 255}, {223, 243, 255}, {229, 246, 255}, {235, 250, 255},
+         {241, 253, 255}, {244, 255, 253}, {247, 255, 249}, {249, 255, 245},
+         {251, 255, 241}, {253, 255, 237}, {255, 255, 233}, {255, 253, 227},
+         {255, 252, 220}, {255, 250, 214}, {255, 248, 207}, {255, 247, 201},
+         {255, 245, 194}, {255, 244, 187}, {255, 243, 180}, {255, 241, 173},
+         {255, 240, 165}, {255, 239, 158}, {255, 238, 151}, {255, 237, 143},
+         {255, 236, 136}, {255, 235, 128}, {255, 235, 120}, {255, 234, 113},
+         {255, 233, 105}, {255, 233,  97}, {255, 232,  89}, {255, 232,  81},
+         {255, 231,  73}, {255, 231,  65}, {255, 231,  56}, {255, 230,  47},
+         {255, 230,  37}, {255, 230,  25}, {255, 230,   5}, {255, 230,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}}
+    },
+    {   // 3.5
+        {{255, 235, 149}, {255, 233, 144}, {255, 231, 140}, {255, 229, 136},
+         {255, 228, 133}, {255, 227, 129}, {255, 226, 126}, {255, 225, 124},
+         {255, 224, 121}, {255, 223, 119}, {255, 222, 116}, {255, 221, 114},
+         {255, 221, 112}, {255, 220, 109}, {255, 220, 107}, {255, 219, 105},
+         {255, 219, 103}, {255, 219, 100}, {255, 219,  98}, {255, 218,  95},
+         {255, 218,  93}, {255, 218,  90}, {255, 218,  88}, {255, 219,  85},
+         {255, 219,  82}, {255, 219,  79}, {255, 219,  76}, {255, 220,  73},
+         {255, 220,  69}, {255, 220,  66}, {255, 221,  62}, {255, 221,  59},
+         {255, 222,  55}, {255, 223,  51}, {255, 223,  47}, {255, 224,  43},
+         {255, 224,  38}, {255, 225,  34}, {255, 226,  29}, {255, 226,  23},
+         {255, 227,  17}, {255, 227,   7}, {255, 228,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 230,   0}, {255, 230,   0}, {255, 231,   0},
+         {255, 231,   0}, {255, 231,   0}, {255, 232,   0}, {255, 232,   0},
+         {255, 232,   0}, {255, 233,   0}, {255, 233,   0}, {255, 233,   0},
+         {255, 234,   0}, {255, 234,   0}, {255, 234,   0}, {255, 234,   0},
+         {255, 235,   0}, {255, 235,   0}, {255, 235,   0}, {255, 235,   0},
+         {255, 235,   0}},
+        {{164, 211, 255}, {174, 216, 255}, {183, 221, 255}, {192, 226, 255},
+         {200, 230, 255}, {208, 235, 255}, {216, 239, 255}, {223, 244, 255},
+         {230, 248, 255}, {238, 252, 255}, {243, 255, 253}, {246, 255, 249},
+         {249, 255, 245}, {251, 255, 240}, {254, 255, 236}, {255, 254, 231},
+         {255, 252, 225}, {255, 250, 219}, {255, 248, 212}, {255, 247, 206},
+         {255, 245, 200}, {255, 244, 194}, {255, 242, 188}, {255, 241, 181},
+         {255, 240, 175}, {255, 239, 168}, {255, 237, 162}, {255, 237, 155},
+         {255, 236, 149}, {255, 235, 142}, {255, 234, 135}, {255, 233, 129},
+         {255, 233, 122}, {255, 232, 115}, {255, 232, 108}, {255, 231, 101},
+         {255, 231,  94}, {255, 231,  87}, {255, 230,  80}, {255, 230,  73},
+         {255, 230,  66}, {255, 230,  59}, {255, 229,  51}, {255, 229,  43},
+         {255, 229,  34}, {255, 229,  24}, {255, 229,   8}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}}
+    },
+    {   // 3.6
+        {{255, 236, 153}, {255, 233, 147}, {255, 231, 142}, {255, 230, 137},
+         {255, 228, 133}, {255, 226, 129}, {255, 225, 125}, {255, 224, 122},
+         {255, 223, 118}, {255, 222, 115}, {255, 221, 113}, {255, 220, 110},
+         {255, 220, 107}, {255, 219, 105}, {255, 219, 102}, {255, 218, 100},
+         {255, 218,  97}, {255, 218,  95}, {255, 217,  92}, {255, 217,  89},
+         {255, 217,  87}, {255, 217,  84}, {255, 217,  81}, {255, 217,  79},
+         {255, 218,  76}, {255, 218,  73}, {255, 218,  70}, {255, 219,  67},
+         {255, 219,  64}, {255, 220,  60}, {255, 220,  57}, {255, 221,  53},
+         {255, 221,  50}, {255, 222,  46}, {255, 222,  42}, {255, 223,  39},
+         {255, 224,  34}, {255, 224,  30}, {255, 225,  25}, {255, 225,  20},
+         {255, 226,  14}, {255, 227,   4}, {255, 227,   0}, {255, 228,   0},
+         {255, 228,   0}, {255, 229,   0}, {255, 229,   0}, {255, 230,   0},
+         {255, 230,   0}, {255, 231,   0}, {255, 231,   0}, {255, 231,   0},
+         {255, 232,   0}, {255, 232,   0}, {255, 232,   0}, {255, 233,   0},
+         {255, 233,   0}, {255, 233,   0}, {255, 233,   0}, {255, 234,   0},
+         {255, 234,   0}, {255, 234,   0}, {255, 234,   0}, {255, 234,   0},
+         {255, 234,   0}},
+        {{165, 212, 255}, {176, 218, 255}, {187, 224, 255}, {198, 230, 255},
+         {208, 236, 255}, {218, 241, 255}, {228, 247, 255}, {237, 253, 255},
+         {243, 255, 252}, {247, 255, 246}, {250, 255, 241}, {253, 255, 236},
+         {255, 254, 230}, {255, 252, 223}, {255, 249, 217}, {255, 247, 210},
+         {255, 245, 204}, {255, 243, 197}, {255, 242, 191}, {255, 240, 185},
+         {255, 239, 179}, {255, 237, 173}, {255, 236, 168}, {255, 235, 162},
+         {255, 234, 156}, {255, 233, 150}, {255, 233, 144}, {255, 232, 138},
+         {255, 231, 132}, {255, 231, 126}, {255, 230, 120}, {255, 230, 114},
+         {255, 229, 108}, {255, 229, 102}, {255, 229,  96}, {255, 229,  90},
+         {255, 229,  84}, {255, 228,  77}, {255, 228,  71}, {255, 228,  65},
+         {255, 228,  58}, {255, 228,  52}, {255, 228,  45}, {255, 228,  38},
+         {255, 228,  30}, {255, 228,  21}, {255, 228,   8}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 230,   0}, {255, 230,   0}, {255, 230,   0}, {255, 230,   0},
+         {255, 230,   0}}
+    },
+    {   // 3.7
+        {{255, 237, 157}, {255, 234, 149}, {255, 231, 143}, {255, 229, 137},
+         {255, 227, 131}, {255, 226, 126}, {255, 224, 122}, {255, 223, 118},
+         {255, 222, 114}, {255, 221, 111}, {255, 220, 107}, {255, 219, 104},
+         {255, 218, 101}, {255, 218,  98}, {255, 217,  96}, {255, 217,  93},
+         {255, 217,  90}, {255, 216,  87}, {255, 216,  85}, {255, 216,  82},
+         {255, 216,  80}, {255, 216,  77}, {255, 216,  74}, {255, 216,  71},
+         {255, 216,  69}, {255, 217,  66}, {255, 217,  63}, {255, 218,  60},
+         {255, 218,  57}, {255, 218,  54}, {255, 219,  51}, {255, 220,  47},
+         {255, 220,  44}, {255, 221,  41}, {255, 221,  37}, {255, 222,  34},
+         {255, 223,  30}, {255, 223,  26}, {255, 224,  22}, {255, 225,  17},
+         {255, 225,  11}, {255, 226,   0}, {255, 226,   0}, {255, 227,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 230,   0}, {255, 230,   0}, {255, 230,   0}, {255, 231,   0},
+         {255, 231,   0}, {255, 231,   0}, {255, 232,   0}, {255, 232,   0},
+         {255, 232,   0}, {255, 232,   0}, {255, 233,   0}, {255, 233,   0},
+         {255, 233,   0}, {255, 233,   0}, {255, 233,   0}, {255, 233,   0},
+         {255, 234,   0}},
+        {{165, 212, 255}, {179, 220, 255}, {193, 228, 255}, {207, 235, 255},
+         {219, 243, 255}, {232, 250, 255}, {241, 255, 253}, {246, 255, 246},
+         {250, 255, 239}, {254, 255, 233}, {255, 253, 225}, {255, 249, 216},
+         {255, 247, 209}, {255, 244, 201}, {255, 242, 194}, {255, 240, 188},
+         {255, 238, 182}, {255, 237, 176}, {255, 235, 170}, {255, 234, 164},
+         {255, 233, 158}, {255, 232, 153}, {255, 231, 147}, {255, 230, 142},
+         {255, 229, 136}, {255, 229, 131}, {255, 228, 126}, {255, 228, 120},
+         {255, 227, 115}, {255, 227, 110}, {255, 227, 104}, {255, 226,  99},
+         {255, 226,  94}, {255, 226,  88}, {255, 226,  83}, {255, 226,  78},
+         {255, 226,  72}, {255, 226,  67}, {255, 227,  62}, {255, 227,  56},
+         {255, 227,  51}, {255, 227,  45}, {255, 227,  39}, {255, 227,  33},
+         {255, 227,  26}, {255, 228,  18}, {255, 228,   7}, {255, 228,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 228,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 230,   0},
+         {255, 230,   0}, {255, 230,   0}, {255, 230,   0}, {255, 230,   0},
+         {255, 230,   0}}
+    },
+    {   // 3.8
+        {{255, 238, 161}, {255, 234, 151}, {255, 231, 142}, {255, 229, 135},
+         {255, 227, 128}, {255, 225, 122}, {255, 223, 117}, {255, 222, 112},
+         {255, 220, 108}, {255, 219, 104}, {255, 218, 100}, {255, 218,  97},
+         {255, 217,  94}, {255, 216,  90}, {255, 216,  87}, {255, 215,  85},
+         {255, 215,  82}, {255, 215,  79}, {255, 215,  76}, {255, 214,  74},
+         {255, 214,  71}, {255, 215,  68}, {255, 215,  66}, {255, 215,  63},
+         {255, 215,  60}, {255, 216,  58}, {255, 216,  55}, {255, 216,  52},
+         {255, 217,  49}, {255, 217,  47}, {255, 218,  44}, {255, 219,  41},
+         {255, 219,  38}, {255, 220,  35}, {255, 221,  31}, {255, 221,  28},
+         {255, 222,  25}, {255, 223,  21}, {255, 223,  17}, {255, 224,  12},
+         {255, 225,   5}, {255, 225,   0}, {255, 226,   0}, {255, 226,   0},
+         {255, 227,   0}, {255, 227,   0}, {255, 228,   0}, {255, 228,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 230,   0}, {255, 230,   0},
+         {255, 230,   0}, {255, 231,   0}, {255, 231,   0}, {255, 231,   0},
+         {255, 231,   0}, {255, 232,   0}, {255, 232,   0}, {255, 232,   0},
+         {255, 232,   0}, {255, 232,   0}, {255, 232,   0}, {255, 232,   0},
+         {255, 233,   0}},
+        {{165, 212, 255}, {184, 222, 255}, {201, 232, 255}, {218, 242, 255},
+         {234, 252, 255}, {243, 255, 248}, {249, 255, 240}, {254, 255, 231},
+         {255, 252, 221}, {255, 248, 211}, {255, 245, 201}, {255, 242, 193},
+         {255, 239, 185}, {255, 237, 178}, {255, 235, 171}, {255, 233, 165},
+         {255, 232, 159}, {255, 230, 153}, {255, 229, 147}, {255, 228, 142},
+         {255, 227, 137}, {255, 226, 132}, {255, 226, 127}, {255, 225, 122},
+         {255, 224, 117}, {255, 224, 112}, {255, 224, 107}, {255, 224, 103},
+         {255, 223,  98}, {255, 223,  93}, {255, 223,  89}, {255, 223,  84},
+         {255, 224,  79}, {255, 224,  75}, {255, 224,  70}, {255, 224,  66},
+         {255, 224,  61}, {255, 225,  56}, {255, 225,  52}, {255, 225,  47},
+         {255, 225,  42}, {255, 226,  37}, {255, 226,  32}, {255, 226,  27},
+         {255, 227,  21}, {255, 227,  14}, {255, 227,   2}, {255, 227,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 228,   0}, {255, 228,   0},
+         {255, 228,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 230,   0}, {255, 230,   0}, {255, 230,   0},
+         {255, 230,   0}}
+    },
+    {   // 3.9
+        {{255, 238, 164}, {255, 234, 151}, {255, 230, 140}, {255, 228, 131},
+         {255, 225, 123}, {255, 223, 116}, {255, 221, 110}, {255, 220, 104},
+         {255, 218, 100}, {255, 217,  95}, {255, 216,  91}, {255, 216,  87},
+         {255, 215,  84}, {255, 214,  80}, {255, 214,  77}, {255, 213,  74},
+         {255, 213,  72}, {255, 213,  69}, {255, 213,  66}, {255, 213,  64},
+         {255, 213,  61}, {255, 213,  58}, {255, 213,  56}, {255, 214,  53},
+         {255, 214,  51}, {255, 214,  48}, {255, 215,  46}, {255, 215,  43},
+         {255, 216,  41}, {255, 216,  38}, {255, 217,  36}, {255, 218,  33},
+         {255, 218,  30}, {255, 219,  28}, {255, 220,  25}, {255, 220,  22},
+         {255, 221,  18}, {255, 222,  15}, {255, 222,  11}, {255, 223,   5},
+         {255, 224,   0}, {255, 224,   0}, {255, 225,   0}, {255, 226,   0},
+         {255, 226,   0}, {255, 227,   0}, {255, 227,   0}, {255, 228,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 230,   0}, {255, 230,   0}, {255, 230,   0}, {255, 230,   0},
+         {255, 231,   0}, {255, 231,   0}, {255, 231,   0}, {255, 231,   0},
+         {255, 231,   0}, {255, 231,   0}, {255, 231,   0}, {255, 232,   0},
+         {255, 232,   0}},
+        {{166, 212, 255}, {190, 226, 255}, {212, 239, 255}, {234, 252, 255},
+         {244, 255, 245}, {251, 255, 233}, {255, 253, 221}, {255, 248, 207},
+         {255, 243, 196}, {255, 240, 185}, {255, 237, 176}, {255, 234, 167},
+         {255, 232, 160}, {255, 230, 153}, {255, 228, 146}, {255, 227, 140},
+         {255, 225, 135}, {255, 224, 129}, {255, 223, 124}, {255, 222, 119},
+         {255, 222, 114}, {255, 221, 110}, {255, 221, 105}, {255, 220, 101},
+         {255, 220,  97}, {255, 220,  93}, {255, 220,  89}, {255, 220,  84},
+         {255, 220,  80}, {255, 220,  76}, {255, 221,  73}, {255, 221,  69},
+         {255, 221,  65}, {255, 221,  61}, {255, 222,  57}, {255, 222,  53},
+         {255, 222,  49}, {255, 223,  45}, {255, 223,  41}, {255, 224,  37},
+         {255, 224,  33}, {255, 225,  29}, {255, 225,  25}, {255, 225,  20},
+         {255, 226,  15}, {255, 226,   8}, {255, 226,   0}, {255, 227,   0},
+         {255, 227,   0}, {255, 227,   0}, {255, 228,   0}, {255, 228,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 228,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}}
+    },
+    {   // 4.0
+        {{255, 239, 168}, {255, 233, 150}, {255, 229, 136}, {255, 226, 124},
+         {255, 223, 115}, {255, 221, 106}, {255, 219, 100}, {255, 217,  93},
+         {255, 216,  88}, {255, 215,  83}, {255, 214,  79}, {255, 213,  75},
+         {255, 213,  72}, {255, 212,  68}, {255, 212,  65}, {255, 211,  62},
+         {255, 211,  59}, {255, 211,  57}, {255, 211,  54}, {255, 211,  52},
+         {255, 211,  49}, {255, 212,  47}, {255, 212,  45}, {255, 212,  43},
+         {255, 213,  40}, {255, 213,  38}, {255, 214,  36}, {255, 214,  34},
+         {255, 215,  31}, {255, 215,  29}, {255, 216,  27}, {255, 217,  24},
+         {255, 217,  22}, {255, 218,  20}, {255, 219,  17}, {255, 220,  14},
+         {255, 220,  11}, {255, 221,   7}, {255, 222,   0}, {255, 222,   0},
+         {255, 223,   0}, {255, 224,   0}, {255, 224,   0}, {255, 225,   0},
+         {255, 225,   0}, {255, 226,   0}, {255, 226,   0}, {255, 227,   0},
+         {255, 227,   0}, {255, 228,   0}, {255, 228,   0}, {255, 228,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 230,   0}, {255, 230,   0}, {255, 230,   0}, {255, 230,   0},
+         {255, 230,   0}, {255, 230,   0}, {255, 230,   0}, {255, 231,   0},
+         {255, 231,   0}},
+        {{166, 213, 255}, {198, 231, 255}, {228, 250, 255}, {245, 255, 243},
+         {254, 255, 227}, {255, 249, 208}, {255, 243, 192}, {255, 238, 178},
+         {255, 234, 167}, {255, 231, 156}, {255, 229, 147}, {255, 226, 139},
+         {255, 224, 132}, {255, 223, 126}, {255, 221, 120}, {255, 220, 114},
+         {255, 219, 109}, {255, 219, 104}, {255, 218, 100}, {255, 217,  95},
+         {255, 217,  91}, {255, 217,  87}, {255, 217,  84}, {255, 217,  80},
+         {255, 217,  76}, {255, 217,  73}, {255, 217,  69}, {255, 217,  66},
+         {255, 217,  63}, {255, 218,  59}, {255, 218,  56}, {255, 218,  53},
+         {255, 219,  50}, {255, 219,  46}, {255, 220,  43}, {255, 220,  40},
+         {255, 221,  37}, {255, 221,  34}, {255, 222,  30}, {255, 222,  27},
+         {255, 223,  24}, {255, 223,  20}, {255, 224,  16}, {255, 224,  12},
+         {255, 225,   6}, {255, 225,   0}, {255, 226,   0}, {255, 226,   0},
+         {255, 226,   0}, {255, 227,   0}, {255, 227,   0}, {255, 227,   0},
+         {255, 227,   0}, {255, 228,   0}, {255, 228,   0}, {255, 228,   0},
+         {255, 228,   0}, {255, 228,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}, {255, 229,   0}, {255, 229,   0}, {255, 229,   0},
+         {255, 229,   0}}
+    }
+};
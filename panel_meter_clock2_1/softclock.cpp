@@ -0,0 +1,107 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Software clock, the time in seconds since 1970 kept in RAM and moved on
+// by the HAL's ticks. The RTC is read once every SOFT_CLOCK_RESYNC seconds
+// instead of on every update, and written when the time is set.
+//
+
+#include "hal.h"
+#include "softclock.h"
+
+SoftClockStats softClockStats;
+
+static bool synced = false;
+static uint32_t syncSeconds;    // RTC time at the last sync
+static uint32_t syncTicks;      // and halTicks()
+static bool shifted = false;    // moved since the RTC was written
+
+//
+// read the RTC and set the soft clock from it, counting a correction if
+// the soft clock had drifted. A tick during the read would put the two a
+// second apart, so the read is repeated.
+//
+
+void softClockSync() {
+    uint32_t ticks;
+    DateTime rtcTime;
+
+    do {
+        ticks = halTicks();
+        rtcTime = halClockNow();
+        softClockStats.reads++;
+    } while (ticks != halTicks());
+
+    if (synced) {
+        long error = (int32_t)(rtcTime.unixtime()-(syncSeconds+(ticks-syncTicks)));
+
+        if (error) {
+            softClockStats.corrections++;
+
+            if (labs(error) > softClockStats.maxCorrection)
+                softClockStats.maxCorrection = labs(error);
+        }
+    }
+
+    syncSeconds = rtcTime.unixtime();
+    syncTicks = ticks;
+    synced = true;
+}
+
+//
+// return the soft clock's time in seconds since 1970, syncing with the
+// RTC first when due unless it has been shifted and the RTC is still to
+// be written, or as a DateTime
+//
+
+uint32_t softClockSeconds() {
+    if (!synced || (!shifted && halTicks()-syncTicks >= SOFT_CLOCK_RESYNC))
+        softClockSync();
+
+    return syncSeconds+(halTicks()-syncTicks);
+}
+
+DateTime softClockNow() {
+    return DateTime(softClockSeconds());
+}
+
+//
+// set the RTC and the soft clock
+//
+
+void softClockAdjust(const DateTime &time) {
+    halClockAdjust(time);
+    softClockStats.writes++;
+
+    syncSeconds = time.unixtime();
+    syncTicks = halTicks();
+    synced = true;
+    shifted = false;
+}
+
+//
+// move the soft clock on or back without writing the RTC, so a run of
+// button steps costs one write when softClockCommit() is called
+//
+
+void softClockShift(int32_t seconds) {
+    if (!synced)
+        softClockSync();
+
+    syncSeconds += seconds;
+    shifted = true;
+}
+
+//
+// write the soft clock to the RTC if it has been shifted
+//
+
+void softClockCommit() {
+    if (shifted)
+        softClockAdjust(DateTime(softClockSeconds()));
+}
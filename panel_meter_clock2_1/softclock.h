@@ -0,0 +1,42 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#ifndef __SOFTCLOCK_H__
+#define __SOFTCLOCK_H__
+
+#include "hal.h"
+
+//
+// Seconds between RTC reads, the soft clock counts the RTC's own ticks
+// in between so it only drifts when the SQW falls back to millis()
+//
+
+#ifndef SOFT_CLOCK_RESYNC
+#define SOFT_CLOCK_RESYNC 3600
+#endif
+
+//
+// RTC reads and the corrections they made, see softClockSync()
+//
+
+struct SoftClockStats {
+    long reads;             // RTC reads
+    long corrections;       // reads that found the soft clock out
+    long maxCorrection;     // largest correction in seconds
+    long writes;            // RTC writes
+};
+
+extern SoftClockStats softClockStats;
+
+extern void softClockSync();
+extern uint32_t softClockSeconds();
+extern DateTime softClockNow();
+extern void softClockAdjust(const DateTime &time);
+extern void softClockShift(int32_t seconds);
+extern void softClockCommit();
+
+#endif
@@ -12,55 +12,47 @@
 // https://www.esrl.noaa.gov/gmd/grad/solcalc/NOAA_Solar_Calculations_day.xls
 //
 
-#include <Arduino.h>
+#include "hal.h"
 #include <math.h>
 #include <stdint.h>
 
 #include "sun.h"
+#include "suntable.h"
 
 //
 // calculate the julian date for a given year, month and day
 //
 
-static long julianDate(int year, int month, int day) {
+long julianDate(int year, int month, int day) {
   return day-32075+1461L*(year+4800+(month-14)/12)/4+367* \
   (month-2-(month-14)/12*12)/12-3*((year+4900+(month-14)/12)/100)/4;
 }
 
+#if !SUN_FIXED_POINT
+
 //
-// calculate the solar noon for the given location, date and timeZone
+// calculate the solar declination (degrees) and equation of time (minutes)
+// for the given number of minutes from noon on julianDay. The whole day
+// number is kept out of the float math so that the time of day is not
+// lost to float precision.
 //
 
-float calcSolarNoon(float latitude, float longitude, int year, int month, int day, int timeZone) {
-    float julianDay = julianDate(year, month, day) -(float)timeZone/24;
-    float julianCentury = (julianDay-2451545)/36525;
-    float geomMeanLongSun = fmod(280.46646+julianCentury*(36000.76983+julianCentury*0.0003032),360);
-    float geomMeanAnomSun = 357.52911+julianCentury*(35999.05029-0.0001537*julianCentury);
-    float eccentEarthOrbit = 0.016708634-julianCentury*(0.000042037+0.0000001267*julianCentury);
-    float meanObliqEcliptic = 23+(26+((21.448-julianCentury*(46.815+julianCentury*(0.00059-julianCentury*0.001813))))/60)/60;
-    float obliqCorr = meanObliqEcliptic+0.00256*cos(radians(125.04-1934.136*julianCentury));
-    float varY = tan(radians(obliqCorr/2))*tan(radians(obliqCorr/2));
+#if SUN_TABLE
 
-    float eqOfTime = 4*degrees(varY*sin(2*radians(geomMeanLongSun))-2*\
-        eccentEarthOrbit*sin(radians(geomMeanAnomSun))+4*\
-        eccentEarthOrbit*varY*sin(radians(geomMeanAnomSun))*\
-        cos(2*radians(geomMeanLongSun))-0.5*\
-        varY*varY*sin(4*radians(geomMeanLongSun))-1.25*\
-        eccentEarthOrbit*eccentEarthOrbit*sin(2*radians(geomMeanAnomSun)));
+static void solarPosition(long julianDay, int32_t minutes, float *declination, float *eqOfTime) {
+    int16_t tableDeclin;
+    int16_t tableEqOfTime;
 
-    return (720-4*longitude-eqOfTime+timeZone*60)/1440;
-}
+    sunTableLookup(julianDay-2451545L, minutes, &tableDeclin, &tableEqOfTime);
 
-//
-// calculate the solar zenith angle for the given location, date and timeZone
-//
+    *declination = (float)tableDeclin/SUN_TABLE_UNITS;
+    *eqOfTime = (float)tableEqOfTime/SUN_TABLE_UNITS;
+}
 
-float calcSolarZenithAngle(float latitude, float longitude,
-    int year, int month, int day, int hour, int minute, int timeZone) {
+#else
 
-    float localPastMidnight = (float)hour/24+((float)minute/1440);
-    float julianDay = julianDate(year, month, day)-0.5+localPastMidnight-(float)timeZone/24;
-    float julianCentury = (julianDay-2451545)/36525;
+static void solarPosition(long julianDay, int32_t minutes, float *declination, float *eqOfTime) {
+    float julianCentury = ((julianDay-2451545L)+minutes/1440.0)/36525;
     float geomMeanLongSun = fmod(280.46646+julianCentury*(36000.76983+julianCentury*0.0003032),360);
     float geomMeanAnomSun = 357.52911+julianCentury*(35999.05029-0.0001537*julianCentury);
     float eccentEarthOrbit = 0.016708634-julianCentury*(0.000042037+0.0000001267*julianCentury);
@@ -74,17 +66,47 @@ float calcSolarZenithAngle(float latitude, float longitude,
     float sunAppLong = sunTrueLong-0.00569-0.00478*sin(radians(125.04-1934.136*julianCentury));
     float meanObliqEcliptic = 23+(26+((21.448-julianCentury*(46.815+julianCentury*(0.00059-julianCentury*0.001813))))/60)/60;
     float obliqCorr = meanObliqEcliptic+0.00256*cos(radians(125.04-1934.136*julianCentury));
-    float sunDeclin = degrees(asin(sin(radians(obliqCorr))*sin(radians(sunAppLong))));
     float varY = tan(radians(obliqCorr/2))*tan(radians(obliqCorr/2));
 
-    float eqOfTime = 4*degrees(varY*sin(2*radians(geomMeanLongSun))-2*\
+    *declination = degrees(asin(sin(radians(obliqCorr))*sin(radians(sunAppLong))));
+
+    *eqOfTime = 4*degrees(varY*sin(2*radians(geomMeanLongSun))-2*\
         eccentEarthOrbit*sin(radians(geomMeanAnomSun))+4*\
         eccentEarthOrbit*varY*sin(radians(geomMeanAnomSun))*\
         cos(2*radians(geomMeanLongSun))-0.5*\
         varY*varY*sin(4*radians(geomMeanLongSun))-1.25*\
         eccentEarthOrbit*eccentEarthOrbit*sin(2*radians(geomMeanAnomSun)));
+}
+
+#endif
+
+//
+// calculate the solar noon for the given location, date and UTC offset in minutes
+//
+
+float calcSolarNoon(float latitude, float longitude, int year, int month, int day, int zoneMinutes) {
+    float sunDeclin;
+    float eqOfTime;
+
+    solarPosition(julianDate(year, month, day), -zoneMinutes, &sunDeclin, &eqOfTime);
+
+    return (720-4*longitude-eqOfTime+zoneMinutes)/1440;
+}
 
-    float trueSolarTime = fmod(localPastMidnight*1440+eqOfTime+4*longitude-60.0*timeZone,1440);
+//
+// calculate the solar zenith angle for the given location, date and UTC offset in minutes
+//
+
+float calcSolarZenithAngle(float latitude, float longitude,
+    int year, int month, int day, int hour, int minute, int zoneMinutes) {
+
+    float sunDeclin;
+    float eqOfTime;
+    float localPastMidnight = (float)hour/24+((float)minute/1440);
+
+    solarPosition(julianDate(year, month, day), hour*60L+minute-720-zoneMinutes, &sunDeclin, &eqOfTime);
+
+    float trueSolarTime = fmod(localPastMidnight*1440+eqOfTime+4*longitude-zoneMinutes,1440);
     float hourAngle = (trueSolarTime/4<0 ) ? trueSolarTime/4+180 : trueSolarTime/4-180;
     float solarZenithAngle = degrees(acos(sin(radians(latitude))*sin(radians(sunDeclin))+cos(radians(latitude))* \
         cos(radians(sunDeclin))*cos(radians(hourAngle))));
@@ -92,6 +114,212 @@ float calcSolarZenithAngle(float latitude, float longitude,
    return solarZenithAngle;
 }
 
+//
+// fill eph with the solar values for the given location, date and UTC offset in minutes.
+//
+// The declination and equation of time are evaluated at local midnight at
+// both ends of the day and interpolated linearly in between, which keeps
+// the zenith angle within 0.041 degrees of the full calculation done in
+// double precision, and 0.14 within a degree of the zenith where acos()
+// runs short of float precision, see tests/sun_test.cpp. Call once a day.
+//
+
+void calcSolarEphemeris(SolarEphemeris *eph, float latitude, float longitude,
+    int year, int month, int day, int zoneMinutes) {
+
+    long julianDay = julianDate(year, month, day);
+    int32_t midnight = -720-zoneMinutes;
+    float sunDeclin[2];
+    float eqOfTime[2];
+
+    solarPosition(julianDay, midnight, &sunDeclin[0], &eqOfTime[0]);
+    solarPosition(julianDay, midnight+1440, &sunDeclin[1], &eqOfTime[1]);
+
+    float sinLat = sin(radians(latitude));
+    float cosLat = cos(radians(latitude));
+
+    eph->sinSin = sinLat*sin(radians(sunDeclin[0]));
+    eph->sinSinDelta = sinLat*sin(radians(sunDeclin[1]))-eph->sinSin;
+    eph->cosCos = cosLat*cos(radians(sunDeclin[0]));
+    eph->cosCosDelta = cosLat*cos(radians(sunDeclin[1]))-eph->cosCos;
+
+    eph->hourAngle = (eqOfTime[0]+4*longitude-zoneMinutes)/4-180;
+    eph->hourAngleDelta = 360+(eqOfTime[1]-eqOfTime[0])/4;
+
+    eph->noon = (720-4*longitude-(eqOfTime[0]+eqOfTime[1])/2+zoneMinutes)/1440;
+    eph->noonZenith = fabs(latitude-(sunDeclin[0]+(sunDeclin[1]-sunDeclin[0])*eph->noon));
+}
+
+//
+// calculate the sinSin and cosCos terms and the hour angle (degrees) for
+// the given number of seconds past local midnight
+//
+
+static void ephemerisTerms(const SolarEphemeris *eph, long seconds,
+    float *sinSin, float *cosCos, float *hourAngle) {
+
+    float localPastMidnight = seconds/86400.0;
+
+    *sinSin = eph->sinSin+eph->sinSinDelta*localPastMidnight;
+    *cosCos = eph->cosCos+eph->cosCosDelta*localPastMidnight;
+    *hourAngle = eph->hourAngle+eph->hourAngleDelta*localPastMidnight;
+}
+
+//
+// calculate the solar zenith angle for the given local time using
+// the values calculated by calcSolarEphemeris()
+//
+
+float calcEphemerisZenithAngle(const SolarEphemeris *eph, int hour, int minute) {
+    float sinSin;
+    float cosCos;
+    float hourAngle;
+
+    ephemerisTerms(eph, hour*3600L+minute*60L, &sinSin, &cosCos, &hourAngle);
+
+    return degrees(acos(constrain(sinSin+cosCos*cos(radians(hourAngle)), -1, 1)));
+}
+
+//
+// calculate the time from solar noon to when the sun is at the given
+// zenith angle as a fraction of the day, using the declination at time.
+// Returns false if the sun stays above the angle all day (halfDay 0.5)
+// or below it all day (halfDay 0).
+//
+
+static bool crossingHalfDay(const SolarEphemeris *eph, float cosZenith, float time, float *halfDay) {
+    float sinSin;
+    float cosCos;
+    float hourAngle;
+
+    ephemerisTerms(eph, time*86400, &sinSin, &cosCos, &hourAngle);
+
+    float cosHourAngle = (cosZenith-sinSin)/cosCos;
+
+    if (cosHourAngle <= -1) {
+        *halfDay = 0.5;
+        return false;
+    }
+
+    if (cosHourAngle >= 1) {
+        *halfDay = 0;
+        return false;
+    }
+
+    *halfDay = degrees(acos(cosHourAngle))/eph->hourAngleDelta;
+    return true;
+}
+
+//
+// calculate when the sun crosses the given zenith angle (degrees) as
+// fractions of the day. Each crossing is worked out again with the
+// declination at the first estimate, which matters for the shallow
+// twilight crossings at high latitudes. Returns false if the sun stays
+// above the angle all day or below it all day.
+//
+
+bool calcSolarCrossing(const SolarEphemeris *eph, float zenith, float *rise, float *set) {
+    float cosZenith = cos(radians(zenith));
+    float halfDay;
+    bool crosses = crossingHalfDay(eph, cosZenith, eph->noon, &halfDay);
+
+    if (crosses) {
+        crossingHalfDay(eph, cosZenith, eph->noon-halfDay, &halfDay);
+        *rise = eph->noon-halfDay;
+        crossingHalfDay(eph, cosZenith, eph->noon+halfDay, &halfDay);
+        *set = eph->noon+halfDay;
+    } else {
+        *rise = eph->noon-halfDay;
+        *set = eph->noon+halfDay;
+    }
+
+    return crosses;
+}
+
+//
+// start tracking the sun from the given number of seconds past local midnight
+//
+
+static void seedSolarTracker(SolarTracker *tracker, const SolarEphemeris *eph, long seconds) {
+    float hourAngle;
+    float step = radians(eph->hourAngleDelta/86400);
+
+    ephemerisTerms(eph, seconds, &tracker->sinSin, &tracker->cosCos, &hourAngle);
+
+    tracker->cosHour = cos(radians(hourAngle));
+    tracker->sinHour = sin(radians(hourAngle));
+    tracker->cosStep = cos(step);
+    tracker->sinStep = sin(step);
+    tracker->cosZenith = constrain(tracker->sinSin+tracker->cosCos*tracker->cosHour, -1, 1);
+    tracker->sinZenith = sqrt(1-tracker->cosZenith*tracker->cosZenith);
+    tracker->zenith = acos(tracker->cosZenith);
+    tracker->seconds = seconds;
+    tracker->steps = 0;
+}
+
+//
+// advance the tracker one second by rotating the hour angle through a
+// fixed step, and move the zenith angle on by the change in its cosine
+// divided by its sine. Near the zenith and the nadir, where that breaks
+// down, fall back to acos.
+//
+
+static void stepSolarTracker(SolarTracker *tracker) {
+    float cosHour = tracker->cosHour*tracker->cosStep-tracker->sinHour*tracker->sinStep;
+
+    tracker->sinHour = tracker->sinHour*tracker->cosStep+tracker->cosHour*tracker->sinStep;
+    tracker->cosHour = cosHour;
+
+    float cosZenith = constrain(tracker->sinSin+tracker->cosCos*cosHour, -1, 1);
+    float sinZenith = sqrt(1-cosZenith*cosZenith);
+
+    if (sinZenith < 0.05 || tracker->sinZenith < 0.05)
+        tracker->zenith = acos(cosZenith);
+    else
+        tracker->zenith += 2*(tracker->cosZenith-cosZenith)/(sinZenith+tracker->sinZenith);
+
+    tracker->cosZenith = cosZenith;
+    tracker->sinZenith = sinZenith;
+    tracker->seconds++;
+    tracker->steps++;
+}
+
+//
+// return the solar zenith angle in degrees for the given number of seconds
+// past local midnight, stepping the tracker when called once a second and
+// seeding it again every SOLAR_TRACKER_RESEED steps, or when time jumps
+//
+
+float updateSolarTracker(SolarTracker *tracker, const SolarEphemeris *eph, long seconds) {
+    if (tracker->steps >= SOLAR_TRACKER_RESEED || (seconds != tracker->seconds && seconds != tracker->seconds+1))
+        seedSolarTracker(tracker, eph, seconds);
+    else if (seconds == tracker->seconds+1)
+        stepSolarTracker(tracker);
+
+    return degrees(tracker->zenith);
+}
+
+#endif
+
+//
+// calculate the day's sunrise, sunset and twilight from the ephemeris
+//
+
+void calcSolarEvents(SolarEvents *events, const SolarEphemeris *eph) {
+    calcSolarCrossing(eph, NAUTICAL_TWILIGHT_ZENITH, &events->nauticalDawn, &events->nauticalDusk);
+    calcSolarCrossing(eph, CIVIL_TWILIGHT_ZENITH, &events->civilDawn, &events->civilDusk);
+    calcSolarCrossing(eph, SUNRISE_ZENITH, &events->sunrise, &events->sunset);
+}
+
+//
+// make the next updateSolarTracker() call seed the tracker, needed
+// whenever the ephemeris changes
+//
+
+void resetSolarTracker(SolarTracker *tracker) {
+    tracker->steps = SOLAR_TRACKER_RESEED;
+}
+
 //
 // return hour and minute from given decimal time
 //
@@ -8,8 +8,104 @@
 #ifndef __SUN_H__
 #define __SUN_H__
 
-extern float calcSolarNoon(float latitude, float longitude, int year, int month, int day, int timeZone);
-extern float calcSolarZenithAngle(float latitude, float longitude, int year, int month, int day, int hour, int minute, int timeZone);
+#include <stdint.h>
+
+//
+// Set SUN_FIXED_POINT to 1 to build the integer solar kernel in sunfixed.cpp
+// in place of the float one in sun.cpp
+//
+
+#ifndef SUN_FIXED_POINT
+#define SUN_FIXED_POINT 0
+#endif
+
+//
+// Set SUN_TABLE to 1 to look the declination and equation of time up in
+// the annual table in suntabledata.h instead of working them out from the
+// orbital series, 0 for the full NOAA calculations
+//
+
+#ifndef SUN_TABLE
+#define SUN_TABLE 1
+#endif
+
+//
+// Solar values that only change once a day, see calcSolarEphemeris()
+//
+
+struct SolarEphemeris {
+#if SUN_FIXED_POINT
+    int16_t latitude;           // binary angle, 65536 to the circle
+    int16_t declination;        // binary angle at local midnight
+    int16_t declinationDelta;   // change in declination over the day
+    int32_t trueSolarTime;      // true solar time at local midnight in 1/4096 minutes
+    int32_t trueSolarTimeDelta; // change in equation of time over the day
+#else
+    float sinSin;           // sin(latitude)*sin(declination) at local midnight
+    float sinSinDelta;      // change in sinSin over the day
+    float cosCos;           // cos(latitude)*cos(declination) at local midnight
+    float cosCosDelta;      // change in cosCos over the day
+    float hourAngle;        // hour angle in degrees at local midnight
+    float hourAngleDelta;   // change in hour angle over the day in degrees
+#endif
+    float noon;             // solar noon as a fraction of the day
+    float noonZenith;       // zenith angle at solar noon in degrees
+};
+
+//
+// Incremental solar position, see updateSolarTracker()
+//
+
+#define SOLAR_TRACKER_RESEED 60
+
+struct SolarTracker {
+#if SUN_FIXED_POINT
+    int16_t declination;        // binary angle when seeded
+    int32_t trueSolarTime;      // true solar time when seeded in 1/4096 minutes
+    uint16_t zenith;            // binary angle
+#else
+    float sinSin;               // sin(latitude)*sin(declination) when seeded
+    float cosCos;               // cos(latitude)*cos(declination) when seeded
+    float cosHour;              // cosine of the hour angle
+    float sinHour;              // sine of the hour angle
+    float cosStep;              // cosine of one second of hour angle
+    float sinStep;              // sine of one second of hour angle
+    float cosZenith;            // cosine of the zenith angle
+    float sinZenith;            // sine of the zenith angle
+    float zenith;               // zenith angle in radians
+#endif
+    long seconds;               // seconds past local midnight
+    uint8_t steps;              // steps since seeded
+};
+
+//
+// Zenith angles of the sun at sunrise/sunset and at the end of civil and
+// nautical twilight, and the day's events as fractions of the day, see
+// calcSolarEvents()
+//
+
+#define SUNRISE_ZENITH 90.833
+#define CIVIL_TWILIGHT_ZENITH 96.0
+#define NAUTICAL_TWILIGHT_ZENITH 102.0
+
+struct SolarEvents {
+    float nauticalDawn;
+    float civilDawn;
+    float sunrise;
+    float sunset;
+    float civilDusk;
+    float nauticalDusk;
+};
+
+extern long julianDate(int year, int month, int day);
+extern float calcSolarNoon(float latitude, float longitude, int year, int month, int day, int zoneMinutes);
+extern float calcSolarZenithAngle(float latitude, float longitude, int year, int month, int day, int hour, int minute, int zoneMinutes);
+extern void calcSolarEphemeris(SolarEphemeris *eph, float latitude, float longitude, int year, int month, int day, int zoneMinutes);
+extern float calcEphemerisZenithAngle(const SolarEphemeris *eph, int hour, int minute);
+extern bool calcSolarCrossing(const SolarEphemeris *eph, float zenith, float *rise, float *set);
+extern void calcSolarEvents(SolarEvents *events, const SolarEphemeris *eph);
+extern float updateSolarTracker(SolarTracker *tracker, const SolarEphemeris *eph, long seconds);
+extern void resetSolarTracker(SolarTracker *tracker);
 extern void decToHourMinute(float time, int *hour, int *minute);
 
 #endif
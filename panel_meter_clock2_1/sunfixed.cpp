@@ -0,0 +1,317 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Integer version of the NOAA solar calculations in sun.cpp, built when
+// SUN_FIXED_POINT is set in sun.h.
+//
+// Orbital longitudes are 32 bit binary angles so the daily motion wraps
+// round the circle without fmod, other angles are 16 bit binary angles
+// and times are kept in 1/4096 minutes. The T^2 terms of the orbital
+// series, the nutation of the obliquity and the secular change in the
+// orbit's eccentricity are left out, all below 0.005 degrees this century.
+//
+
+#include "hal.h"
+#include <stdint.h>
+
+#include "sun.h"
+
+#if SUN_FIXED_POINT
+
+#include "fixtrig.h"
+#include "suntable.h"
+
+// 32 bit binary angles at J2000 and their motion per day and per minute,
+// the longitude of the moon's ascending node (omega) moves backwards.
+// The mean longitude is in suntable.h.
+
+#define MEAN_ANOM_J2000 4265488430UL
+#define MEAN_ANOM_DAY 11758669UL
+#define MEAN_ANOM_MINUTE 8166L
+#define OMEGA_J2000 1491785307UL
+#define OMEGA_DAY 631763UL
+#define OMEGA_MINUTE 439L
+#define ABERRATION 67884L
+
+// obliquity of the ecliptic as a 16 bit binary angle and days per unit of change
+
+#define OBLIQUITY_J2000 4267
+#define OBLIQUITY_DAYS 15429L
+
+// time units
+
+#define MINUTE 4096L
+#define DAY (1440*MINUTE)
+
+//
+// convert degrees to a 16 bit binary angle
+//
+
+static int16_t binaryAngle(float degrees) {
+    return (int16_t)floor(degrees*(65536.0/360)+0.5);
+}
+
+//
+// calculate the solar declination and equation of time (1/4096 minutes)
+// for the given number of minutes from noon on J2000+days
+//
+
+#if SUN_TABLE
+
+static void solarPosition(long days, int32_t minutes, int16_t *declination, int32_t *eqOfTime) {
+    int16_t tableDeclin;
+    int16_t tableEqOfTime;
+
+    sunTableLookup(days, minutes, &tableDeclin, &tableEqOfTime);
+
+    // 65536/360 binary angle units to the degree, 4096 time units to the minute
+    *declination = (tableDeclin*5825L) >> 15;
+    *eqOfTime = tableEqOfTime*(4096L/SUN_TABLE_UNITS);
+}
+
+#else
+
+static void solarPosition(long days, int32_t minutes, int16_t *declination, int32_t *eqOfTime) {
+    uint32_t meanLong = MEAN_LONG_J2000+(uint32_t)days*MEAN_LONG_DAY+minutes*MEAN_LONG_MINUTE;
+    uint32_t meanAnom = MEAN_ANOM_J2000+(uint32_t)days*MEAN_ANOM_DAY+minutes*MEAN_ANOM_MINUTE;
+    uint32_t omega = OMEGA_J2000-(uint32_t)days*OMEGA_DAY-minutes*OMEGA_MINUTE;
+
+    uint16_t l = meanLong >> 16;
+    uint16_t m = meanAnom >> 16;
+    int16_t sinM = isin(m);
+    int16_t sin2M = isin(2*m);
+
+    int32_t eqOfCtr = 697L*sinM+((233L*sin2M) >> 5);
+    uint32_t appLong = meanLong+eqOfCtr-ABERRATION-((57L*isin(omega >> 16)) >> 5);
+    uint16_t obliquity = OBLIQUITY_J2000-days/OBLIQUITY_DAYS;
+
+    *declination = iasin((int32_t)isin(obliquity)*isin(appLong >> 16));
+
+    *eqOfTime = ((40398L*isin(2*l)) >> 15)-\
+        ((31370L*sinM) >> 15)+\
+        ((2700L*(((int32_t)sinM*icos(2*l)) >> 15)) >> 15)-\
+        ((869L*isin(4*l)) >> 15)-\
+        ((328L*sin2M) >> 15);
+}
+
+#endif
+
+//
+// zenith angle as a binary angle, using the haversine form so that the
+// precision holds up with the sun close to the zenith or the nadir
+//
+
+static uint16_t zenithAngle(int16_t latitude, int16_t declination, int32_t trueSolarTime) {
+    int32_t time = (trueSolarTime-720*MINUTE) % DAY;
+
+    if (time < 0)
+        time += DAY;
+
+    // 90 units of time to each unit of binary angle
+    uint16_t hourAngle = time/90;
+
+    int32_t sinHalf = isin((uint16_t)(latitude-declination)/2);
+    int32_t havLat = sinHalf*sinHalf;
+
+    // cos(lat)cos(decl)hav(hour) as two rounded Q15 factors, each the
+    // sine of the half hour angle times one of the cosines, so the
+    // product stays in 32 bits and keeps its precision as the hour
+    // angle goes to 0
+
+    sinHalf = isin(hourAngle/2);
+    int32_t latPart = (sinHalf*icos(latitude)+16384) >> 15;
+    int32_t declPart = (sinHalf*icos(declination)+16384) >> 15;
+
+    uint32_t hav = havLat+latPart*declPart;
+
+    if (hav > Q30_ONE)
+        hav = Q30_ONE;
+
+    if (hav > Q30_ONE/2)
+        return BAM_180-2*iasin((int32_t)isqrt32(Q30_ONE-hav) << 15);
+
+    return 2*iasin((int32_t)isqrt32(hav) << 15);
+}
+
+//
+// calculate the solar noon for the given location, date and UTC offset in minutes
+//
+
+float calcSolarNoon(float latitude, float longitude, int year, int month, int day, int zoneMinutes) {
+    int16_t sunDeclin;
+    int32_t eqOfTime;
+
+    solarPosition(julianDate(year, month, day)-2451545L, -zoneMinutes, &sunDeclin, &eqOfTime);
+
+    return (720*MINUTE-(int32_t)(longitude*4*MINUTE)-eqOfTime+zoneMinutes*MINUTE)/(float)DAY;
+}
+
+//
+// calculate the solar zenith angle for the given location, date and UTC offset in minutes
+//
+
+float calcSolarZenithAngle(float latitude, float longitude,
+    int year, int month, int day, int hour, int minute, int zoneMinutes) {
+
+    int16_t sunDeclin;
+    int32_t eqOfTime;
+    int32_t localPastMidnight = hour*60L+minute;
+
+    solarPosition(julianDate(year, month, day)-2451545L, localPastMidnight-720-zoneMinutes, &sunDeclin, &eqOfTime);
+
+    int32_t trueSolarTime = localPastMidnight*MINUTE+eqOfTime+(int32_t)(longitude*4*MINUTE)-zoneMinutes*MINUTE;
+
+    return zenithAngle(binaryAngle(latitude), sunDeclin, trueSolarTime)*(360.0/65536);
+}
+
+//
+// fill eph with the solar values for the given location, date and UTC offset in minutes,
+// interpolated over the day as in sun.cpp. Call once a day.
+//
+
+void calcSolarEphemeris(SolarEphemeris *eph, float latitude, float longitude,
+    int year, int month, int day, int zoneMinutes) {
+
+    long days = julianDate(year, month, day)-2451545L;
+    int32_t midnight = -720-zoneMinutes;
+    int16_t sunDeclin[2];
+    int32_t eqOfTime[2];
+
+    solarPosition(days, midnight, &sunDeclin[0], &eqOfTime[0]);
+    solarPosition(days, midnight+1440, &sunDeclin[1], &eqOfTime[1]);
+
+    eph->latitude = binaryAngle(latitude);
+    eph->declination = sunDeclin[0];
+    eph->declinationDelta = sunDeclin[1]-sunDeclin[0];
+    eph->trueSolarTime = eqOfTime[0]+(int32_t)(longitude*4*MINUTE)-zoneMinutes*MINUTE;
+    eph->trueSolarTimeDelta = eqOfTime[1]-eqOfTime[0];
+
+    int32_t noon = 720*MINUTE-(int32_t)(longitude*4*MINUTE)-(eqOfTime[0]+eqOfTime[1])/2+zoneMinutes*MINUTE;
+    int16_t noonDeclin = sunDeclin[0]+((int32_t)eph->declinationDelta*noon)/DAY;
+
+    eph->noon = noon/(float)DAY;
+    eph->noonZenith = abs(eph->latitude-noonDeclin)*(360.0/65536);
+}
+
+//
+// calculate the declination and true solar time for the given number of
+// seconds past local midnight
+//
+
+static void ephemerisTerms(const SolarEphemeris *eph, long seconds, int16_t *declination, int32_t *trueSolarTime) {
+    *declination = eph->declination+((int32_t)eph->declinationDelta*seconds)/86400L;
+    *trueSolarTime = (seconds*MINUTE)/60+eph->trueSolarTime+(eph->trueSolarTimeDelta*(seconds/60))/1440;
+}
+
+//
+// calculate the solar zenith angle for the given local time using
+// the values calculated by calcSolarEphemeris()
+//
+
+float calcEphemerisZenithAngle(const SolarEphemeris *eph, int hour, int minute) {
+    int16_t declination;
+    int32_t trueSolarTime;
+
+    ephemerisTerms(eph, hour*3600L+minute*60L, &declination, &trueSolarTime);
+
+    return zenithAngle(eph->latitude, declination, trueSolarTime)*(360.0/65536);
+}
+
+//
+// calculate the time from solar noon to when the sun is at the given
+// zenith angle as a fraction of the day, using the declination at time.
+// Returns false if the sun stays above the angle all day (halfDay 0.5)
+// or below it all day (halfDay 0).
+//
+
+static bool crossingHalfDay(const SolarEphemeris *eph, int16_t cosZenith, float time, float *halfDay) {
+    int16_t declination;
+    int32_t trueSolarTime;
+
+    ephemerisTerms(eph, time*86400, &declination, &trueSolarTime);
+
+    // cos(hour) = (cos(zenith)-sin(lat)sin(decl))/cos(lat)cos(decl), both
+    // sides halved to Q29 so the numerator can't overflow
+
+    int32_t sinSin = (int32_t)isin(eph->latitude)*isin(declination);
+    int32_t above = ((int32_t)cosZenith << 14)-(sinSin >> 1);
+    uint32_t cosCos = ((int32_t)icos(eph->latitude)*icos(declination)) >> 1;
+    uint32_t rest = labs(above);
+
+    if (rest >= cosCos) {
+        *halfDay = above < 0 ? 0.5 : 0;
+        return false;
+    }
+
+    // the quotient, under 1, to Q30 a bit at a time, as a 32 bit divide
+    // would but without the 64 bit dividend
+
+    int32_t cosHourAngle = 0;
+
+    for (uint8_t bit = 0; bit < 30; bit++) {
+        rest <<= 1;
+        cosHourAngle <<= 1;
+
+        if (rest >= cosCos) {
+            rest -= cosCos;
+            cosHourAngle |= 1;
+        }
+    }
+
+    *halfDay = iacos(above < 0 ? -cosHourAngle : cosHourAngle)/65536.0;
+    return true;
+}
+
+//
+// calculate when the sun crosses the given zenith angle (degrees) as
+// fractions of the day, refined as in sun.cpp. Returns false if the sun
+// stays above the angle all day or below it all day.
+//
+
+bool calcSolarCrossing(const SolarEphemeris *eph, float zenith, float *rise, float *set) {
+    int16_t cosZenith = icos(binaryAngle(zenith));
+    float halfDay;
+    bool crosses = crossingHalfDay(eph, cosZenith, eph->noon, &halfDay);
+
+    if (crosses) {
+        crossingHalfDay(eph, cosZenith, eph->noon-halfDay, &halfDay);
+        *rise = eph->noon-halfDay;
+        crossingHalfDay(eph, cosZenith, eph->noon+halfDay, &halfDay);
+        *set = eph->noon+halfDay;
+    } else {
+        *rise = eph->noon-halfDay;
+        *set = eph->noon+halfDay;
+    }
+
+    return crosses;
+}
+
+//
+// return the solar zenith angle in degrees for the given number of seconds
+// past local midnight. The integer zenith is table lookups only, so a step
+// moves the true solar time on by one second and works the angle out again,
+// with the declination and equation of time seeded every
+// SOLAR_TRACKER_RESEED steps or when time jumps.
+//
+
+float updateSolarTracker(SolarTracker *tracker, const SolarEphemeris *eph, long seconds) {
+    if (tracker->steps >= SOLAR_TRACKER_RESEED || (seconds != tracker->seconds && seconds != tracker->seconds+1)) {
+        ephemerisTerms(eph, seconds, &tracker->declination, &tracker->trueSolarTime);
+        tracker->steps = 0;
+    } else if (seconds == tracker->seconds+1) {
+        tracker->steps++;
+    }
+
+    tracker->seconds = seconds;
+    tracker->zenith = zenithAngle(eph->latitude, tracker->declination,
+        tracker->trueSolarTime+(tracker->steps*MINUTE)/60);
+
+    return tracker->zenith*(360.0/65536);
+}
+
+#endif
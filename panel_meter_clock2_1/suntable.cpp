@@ -0,0 +1,40 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#include "hal.h"
+#include <stdint.h>
+
+#include "sun.h"
+
+#if SUN_TABLE
+
+#include "suntable.h"
+#include "suntabledata.h"
+
+//
+// look up the solar declination and equation of time for the given number
+// of minutes from noon on J2000+days, interpolating between table entries.
+// Regenerate suntabledata.h with tools/suntable.py.
+//
+
+void sunTableLookup(long days, int32_t minutes, int16_t *declination, int16_t *eqOfTime) {
+    uint32_t meanLong = MEAN_LONG_J2000+(uint32_t)days*MEAN_LONG_DAY+minutes*MEAN_LONG_MINUTE;
+    uint8_t idx = meanLong >> (32-SUN_TABLE_BITS);
+    int32_t frac = (meanLong >> (17-SUN_TABLE_BITS)) & 0x7FFF;
+    int16_t first;
+    int16_t next;
+
+    first = pgm_read_word(&SUN_TABLE_DATA[idx][0]);
+    next = pgm_read_word(&SUN_TABLE_DATA[idx+1][0]);
+    *declination = first+(((next-first)*frac) >> 15);
+
+    first = pgm_read_word(&SUN_TABLE_DATA[idx][1]);
+    next = pgm_read_word(&SUN_TABLE_DATA[idx+1][1]);
+    *eqOfTime = first+(((next-first)*frac) >> 15);
+}
+
+#endif
@@ -0,0 +1,29 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#ifndef __SUNTABLE_H__
+#define __SUNTABLE_H__
+
+#include <stdint.h>
+
+//
+// geometric mean longitude of the sun as a 32 bit binary angle at J2000,
+// and its motion per day and per minute. It is the phase of the tropical
+// year that the table in suntabledata.h is indexed by.
+//
+
+#define MEAN_LONG_J2000 3346095204UL
+#define MEAN_LONG_DAY 11759231UL
+#define MEAN_LONG_MINUTE 8166L
+
+// table units per degree of declination and per minute of time
+
+#define SUN_TABLE_UNITS 1024
+
+extern void sunTableLookup(long days, int32_t minutes, int16_t *declination, int16_t *eqOfTime);
+
+#endif
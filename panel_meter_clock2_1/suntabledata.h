@@ -0,0 +1,48 @@
+//
+// Generated by tools/suntable.py, do not edit.
+//
+// Solar declination (1/1024 degree) and equation of time (1/1024 minute)
+// at 128 steps of the sun's mean longitude, 516 bytes of flash.
+//
+// Worst case error against the NOAA formulas, hourly over 2000-2100:
+//     declination 0.0218 degrees, equation of time 0.1388 minutes,
+//     0.0468 degrees of zenith angle.
+//
+
+#define SUN_TABLE_BITS 7
+
+static const int16_t SUN_TABLE_DATA[129][2] PROGMEM = {
+    {   759,  -6990}, {  1910,  -6114}, {  3055,  -5236}, {  4192,  -4362},
+    {  5319,  -3502}, {  6433,  -2661}, {  7532,  -1847}, {  8613,  -1067},
+    {  9675,   -328}, { 10715,    364}, { 11731,   1004}, { 12721,   1585},
+    { 13683,   2103}, { 14613,   2553}, { 15511,   2932}, { 16375,   3237},
+    { 17201,   3465}, { 17989,   3614}, { 18735,   3685}, { 19439,   3676},
+    { 20098,   3589}, { 20710,   3426}, { 21275,   3189}, { 21790,   2883},
+    { 22253,   2512}, { 22664,   2081}, { 23022,   1597}, { 23325,   1067},
+    { 23572,    498}, { 23763,   -101}, { 23897,   -722}, { 23973,  -1355},
+    { 23993,  -1992}, { 23955,  -2622}, { 23859,  -3237}, { 23707,  -3828},
+    { 23499,  -4385}, { 23235,  -4901}, { 22916,  -5367}, { 22543,  -5776},
+    { 22119,  -6122}, { 21643,  -6399}, { 21117,  -6601}, { 20543,  -6726},
+    { 19923,  -6770}, { 19258,  -6731}, { 18550,  -6608}, { 17801,  -6400},
+    { 17013,  -6108}, { 16187,  -5733}, { 15327,  -5279}, { 14433,  -4746},
+    { 13508,  -4140}, { 12554,  -3464}, { 11574,  -2724}, { 10568,  -1923},
+    {  9540,  -1069}, {  8491,   -167}, {  7424,    776}, {  6341,   1754},
+    {  5243,   2760}, {  4133,   3787}, {  3013,   4826}, {  1886,   5871},
+    {   753,   6914}, {  -383,   7947}, { -1520,   8962}, { -2656,   9950},
+    { -3789,  10904}, { -4915,  11816}, { -6034,  12677}, { -7141,  13479},
+    { -8236,  14215}, { -9315,  14877}, {-10376,  15457}, {-11417,  15948},
+    {-12434,  16343}, {-13426,  16638}, {-14389,  16826}, {-15321,  16903},
+    {-16219,  16865}, {-17081,  16709}, {-17903,  16435}, {-18684,  16042},
+    {-19420,  15529}, {-20110,  14900}, {-20750,  14157}, {-21339,  13306},
+    {-21873,  12351}, {-22351,  11301}, {-22772,  10162}, {-23132,   8945},
+    {-23431,   7660}, {-23668,   6317}, {-23841,   4930}, {-23949,   3509},
+    {-23992,   2069}, {-23970,    622}, {-23883,   -819}, {-23730,  -2241},
+    {-23514,  -3633}, {-23233,  -4978}, {-22890,  -6267}, {-22486,  -7489},
+    {-22022,  -8635}, {-21500,  -9695}, {-20923, -10662}, {-20292, -11529},
+    {-19610, -12291}, {-18879, -12943}, {-18102, -13483}, {-17280, -13910},
+    {-16418, -14222}, {-15517, -14422}, {-14581, -14510}, {-13612, -14490},
+    {-12612, -14365}, {-11585, -14140}, {-10533, -13821}, { -9460, -13414},
+    { -8367, -12926}, { -7257, -12363}, { -6134, -11733}, { -4999, -11044},
+    { -3855, -10303}, { -2705,  -9520}, { -1551,  -8701}, {  -395,  -7855},
+    {   759,  -6990}
+};
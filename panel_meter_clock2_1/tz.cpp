@@ -0,0 +1,285 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// POSIX TZ rules, see tz.h
+//
+
+#include "hal.h"
+#include "tz.h"
+
+#define RULE_JULIAN 0       // Jn, 1-365 not counting February 29th
+#define RULE_DAY 1          // n, 0-365
+#define RULE_MONTH 2        // Mm.w.d, day d of week w of month m
+
+#define DEFAULT_RULE_TIME 7200L
+
+struct TzRule {
+    uint8_t kind;
+    uint8_t month;
+    uint8_t week;           // 5 for the last
+    uint8_t weekday;        // 0 for Sunday
+    uint16_t day;
+    int32_t time;           // seconds past local midnight
+};
+
+struct TzZone {
+    int16_t offset;         // standard time, minutes east of UTC
+    int16_t shift;          // minutes DST moves the clock on, 0 for none
+    TzRule start;           // on standard time
+    TzRule end;             // on daylight time
+};
+
+static TzZone zone;
+
+// the year's table, three stretches between the start of the year, the
+// two transitions and the end of the year and their shifts
+
+static uint16_t tableYear;
+static uint32_t table[4];
+static int16_t tableShift[3];
+
+// the stretch of the table the last time fell in, empty to start
+
+static uint32_t stretchFrom;
+static uint32_t stretchSpan;
+static int16_t stretchShift;
+
+//
+// parsing, each returns the text after what it read or NULL
+//
+
+static const char *parseName(const char *text) {
+    const char *start = text;
+
+    if (*text == '<') {
+        while (*++text != '>') {
+            if (!isalnum(*text) && *text != '+' && *text != '-')
+                return NULL;
+        }
+        return text-start > 1 ? text+1 : NULL;
+    }
+
+    while (isalpha(*text))
+        text++;
+
+    return text-start >= 3 ? text : NULL;
+}
+
+static const char *parseNumber(const char *text, int max, int *value) {
+    if (!isdigit(*text))
+        return NULL;
+
+    *value = 0;
+    while (isdigit(*text)) {
+        *value = *value*10+*text++-'0';
+        if (*value > max)
+            return NULL;
+    }
+
+    return text;
+}
+
+// [+-]hh[:mm[:ss]] in seconds
+
+static const char *parseTime(const char *text, int maxHours, int32_t *seconds) {
+    int sign = 1;
+    int value;
+
+    if (*text == '+' || *text == '-')
+        sign = *text++ == '-' ? -1 : 1;
+
+    if (!(text = parseNumber(text, maxHours, &value)))
+        return NULL;
+    *seconds = value*3600L;
+
+    for (int32_t unit = 60; unit && *text == ':'; unit /= 60) {
+        if (!(text = parseNumber(text+1, 59, &value)))
+            return NULL;
+        *seconds += value*unit;
+    }
+
+    *seconds *= sign;
+    return text;
+}
+
+static const char *parseRule(const char *text, TzRule *rule) {
+    int value;
+
+    if (*text == 'J') {
+        rule->kind = RULE_JULIAN;
+        if (!(text = parseNumber(text+1, 365, &value)) || !value)
+            return NULL;
+        rule->day = value;
+    } else if (*text == 'M') {
+        rule->kind = RULE_MONTH;
+        if (!(text = parseNumber(text+1, 12, &value)) || !value || *text != '.')
+            return NULL;
+        rule->month = value;
+        if (!(text = parseNumber(text+1, 5, &value)) || !value || *text != '.')
+            return NULL;
+        rule->week = value;
+        if (!(text = parseNumber(text+1, 6, &value)))
+            return NULL;
+        rule->weekday = value;
+    } else {
+        rule->kind = RULE_DAY;
+        if (!(text = parseNumber(text, 365, &value)))
+            return NULL;
+        rule->day = value;
+    }
+
+    rule->time = DEFAULT_RULE_TIME;
+    if (*text == '/')
+        text = parseTime(text+1, 167, &rule->time);
+
+    return text;
+}
+
+//
+// set the zone from a TZ string, returns false and keeps the zone as it
+// was if the string can't be read
+//
+
+bool tzSet(const char *tz) {
+    TzZone parsed;
+    int32_t west;
+    int32_t dstWest;
+    const char *text = tz;
+
+    if (!(text = parseName(text)) || !(text = parseTime(text, 24, &west)))
+        return false;
+
+    parsed.offset = -west/60;
+    parsed.shift = 0;
+
+    if (*text) {
+        if (!(text = parseName(text)))
+            return false;
+
+        dstWest = west-3600;
+        if (*text && *text != ',' && !(text = parseTime(text, 24, &dstWest)))
+            return false;
+
+        parsed.shift = (west-dstWest)/60;
+
+        if (*text) {
+            if (*text != ',' || !(text = parseRule(text+1, &parsed.start)) ||
+                *text != ',' || !(text = parseRule(text+1, &parsed.end)) || *text)
+                return false;
+        } else {
+            parseRule("M3.2.0", &parsed.start);
+            parseRule("M11.1.0", &parsed.end);
+        }
+    }
+
+    zone = parsed;
+    tableYear = 0;
+    stretchSpan = 0;
+    return true;
+}
+
+int16_t tzStandardOffset() {
+    return zone.offset;
+}
+
+//
+// a rule's time in the year on the clock it is given in
+//
+
+static uint32_t ruleTime(const TzRule *rule, uint16_t year) {
+    uint32_t midnight;
+
+    if (rule->kind == RULE_MONTH) {
+        DateTime first(year, rule->month, 1);
+        uint32_t next = rule->month == 12 ? DateTime(year+1, 1, 1).unixtime() :
+            DateTime(year, rule->month+1, 1).unixtime();
+        uint8_t days = (next-first.unixtime())/86400L;
+        uint8_t day = 1+(rule->weekday+7-first.dayOfTheWeek()) % 7+(rule->week-1)*7;
+
+        while (day > days)
+            day -= 7;
+
+        midnight = first.unixtime()+(day-1)*86400L;
+    } else {
+        uint16_t day = rule->day;
+
+        if (rule->kind == RULE_JULIAN)
+            day -= (year % 4 != 0 || day < 60) ? 1 : 0;
+
+        midnight = DateTime(year, 1, 1).unixtime()+day*86400L;
+    }
+
+    return midnight+rule->time;
+}
+
+//
+// build the year's table, DST is the middle stretch unless it starts
+// later in the year than it ends, as it does south of the equator
+//
+
+static void tzYear(uint16_t year) {
+    uint32_t yearStart = DateTime(year, 1, 1).unixtime();
+    uint32_t yearEnd = DateTime(year+1, 1, 1).unixtime();
+    uint32_t start = ruleTime(&zone.start, year);
+    uint32_t end = ruleTime(&zone.end, year)-zone.shift*60L;
+    bool southern = start >= end;
+
+    table[0] = yearStart;
+    table[1] = constrain(southern ? end : start, yearStart, yearEnd);
+    table[2] = constrain(southern ? start : end, yearStart, yearEnd);
+    table[3] = yearEnd;
+
+    tableShift[0] = southern ? zone.shift : 0;
+    tableShift[1] = southern ? 0 : zone.shift;
+    tableShift[2] = tableShift[0];
+
+    tableYear = year;
+}
+
+//
+// minutes to add to a standard time for the local time
+//
+
+int16_t tzShift(uint32_t standard) {
+    // before stretchFrom wraps round to more than the span
+    if (standard-stretchFrom < stretchSpan)
+        return stretchShift;
+
+    if (!zone.shift) {
+        stretchFrom = 0;
+        stretchSpan = 0xFFFFFFFF;
+        stretchShift = 0;
+        return 0;
+    }
+
+    uint16_t year = DateTime(standard).year();
+
+    if (year != tableYear)
+        tzYear(year);
+
+    uint8_t stretch = 0;
+
+    while (stretch < 2 && standard >= table[stretch+1])
+        stretch++;
+
+    stretchFrom = table[stretch];
+    stretchSpan = table[stretch+1]-table[stretch];
+    stretchShift = tableShift[stretch];
+    return stretchShift;
+}
+
+//
+// the standard time for a local time, the later one in the hour
+// that repeats when the clocks go back
+//
+
+uint32_t tzStandard(uint32_t local) {
+    uint32_t standard = local-tzShift(local)*60L;
+
+    return local-tzShift(standard)*60L;
+}
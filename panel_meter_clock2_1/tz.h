@@ -0,0 +1,36 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+#ifndef __TZ_H__
+#define __TZ_H__
+
+#include "hal.h"
+
+//
+// Time zone rules from a POSIX TZ string, std offset [dst [offset]
+// [,start[/time],end[/time]]], for example
+//
+//     PST8PDT,M3.2.0,M11.1.0        US Pacific
+//     CET-1CEST,M3.5.0,M10.5.0/3    central Europe
+//     AEST-10AEDT,M10.1.0,M4.1.0/3  New South Wales
+//     <+0545>-5:45                  Nepal
+//
+// Offsets are west of UTC as POSIX has them and may have minutes, the
+// dates are Jn, n or Mm.w.d. A dst name without dates takes the US ones.
+//
+// Times are seconds since 1970 on the local standard time the RTC keeps.
+// The year's transitions are put in a table the first time a time in it
+// is asked about, and the stretch of the table the last time fell in is
+// kept, so most calls are one compare.
+//
+
+extern bool tzSet(const char *tz);
+extern int16_t tzStandardOffset();
+extern int16_t tzShift(uint32_t standard);
+extern uint32_t tzStandard(uint32_t local);
+
+#endif
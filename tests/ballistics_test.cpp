@@ -0,0 +1,219 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The needle ballistics, needleMove() and needleUpdate() on the virtual
+// clock driving a model of each meter.
+//
+// The meter is taken as a second order system, its natural frequency
+// and damping ratio as set in the menu, driven by the PWM the HAL is
+// given, held between the updates on the animation timer. The settling
+// time is from the start of the move until the needle stays within 2%
+// of the move of where it was sent, the overshoot how far past it went
+// as a percentage of the move.
+//
+// With the meter as set, a step of a minute or an hour unshaped should
+// ring as the meter does, and ZV and ZVD should settle it in a fraction
+// of the time with next to no overshoot, as should the sweep back. With
+// the meter 15% off its setting the shapers should still keep most of
+// the overshoot away, ZVD more of it than ZV.
+//
+// Given a file name, every move is written to it as CSV for
+// tools/needlesim.py to plot.
+//
+
+#include "hal.h"
+#include "config.h"
+#include "needle.h"
+#include "test.h"
+
+#define DT 0.0005           // s, the model's step
+#define BAND 0.02           // settled within 2% of the move
+#define LENGTH 5000         // ms, each move's run
+#define SWEEP 1000          // ms
+#define TRACE_STEP 5        // ms between the CSV's rows
+
+// overshoot of an unshaped step, exp(-pi*zeta/sqrt(1-zeta^2)) at the
+// default damping of 0.3 is 37%
+
+#define RINGING 30          // %
+
+struct Run {
+    const char *title;
+    uint8_t meter;
+    uint8_t from;           // hour or minute
+    uint8_t to;
+    uint16_t duration;
+    uint8_t easing;
+};
+
+static const Run runs[] = {
+    { "step a minute", NEEDLE_MINUTE, 30, 31, 0, EASE_LINEAR },
+    { "step an hour", NEEDLE_HOUR, 5, 6, 0, EASE_LINEAR },
+    { "linear sweep back", NEEDLE_MINUTE, 60, 0, SWEEP, EASE_LINEAR },
+    { "damped sweep back", NEEDLE_MINUTE, 60, 0, SWEEP, EASE_DAMPED },
+};
+
+#define RUNS (sizeof(runs)/sizeof(runs[0]))
+
+// the bounds with the meter as set, settling in ms from the start of
+// the move and overshoot in %, for ZV and ZVD
+
+struct Bounds {
+    double settle[SHAPE_COUNT];
+    double overshoot[SHAPE_COUNT];
+};
+
+static const Bounds stepBounds = { { 0, 400, 700 }, { 0, 2.5, 0.75 } };
+static const Bounds sweepBounds = { { 0, 1400, 1600 }, { 0, 0.5, 0.5 } };
+
+// with the meter off its setting, the overshoot of each shaper, worst
+// with the meter slower than set
+
+static const double offOvershoot[SHAPE_COUNT] = { 0, 12, 2.5 };
+
+static FILE *csv;
+static double needle[(int)(LENGTH/1000.0/DT)];
+
+static uint16_t meterPwm(uint8_t meter) {
+    return meter == NEEDLE_HOUR ? halLinuxHourMeter : halLinuxMinuteMeter;
+}
+
+//
+// make a move with a shaper on a meter off its setting by a fraction,
+// the settling time in ms and the overshoot in %
+//
+
+static void runMove(const Run *run, uint8_t shape, float off, double *settle, double *overshoot) {
+    uint8_t meter = run->meter;
+    double omega = 2*M_PI*meterFrequency[meter]/10.0*(1+off);
+    double zeta = meterDamping[meter]/100.0;
+
+    shaper = shape;
+    needleShape();
+
+    // settled where the move starts
+
+    needleMove(meter, NEEDLE_POSITION(run->from), 0, EASE_LINEAR);
+    while (needleUpdate())
+        delay(NEEDLE_STEP);
+
+    double start = meterPwm(meter);
+    double position = start;
+    double speed = 0;
+    int samples = 0;
+
+    needleMove(meter, NEEDLE_POSITION(run->to), run->duration, run->easing);
+
+    for (long ms = 0; ms < LENGTH; ms += NEEDLE_STEP) {
+        double pwm = meterPwm(meter);
+
+        for (int n = 0; n < NEEDLE_STEP/1000.0/DT; n++) {
+            // semi-implicit Euler, stable for the step against the frequency
+
+            speed += (omega*omega*(pwm-position)-2*zeta*omega*speed)*DT;
+            position += speed*DT;
+
+            if (csv && off == 0 && samples % (int)(TRACE_STEP/1000.0/DT) == 0)
+                fprintf(csv, "%s,%d,%ld,%.1f,%.2f\n", run->title, shape,
+                    lround(samples*DT*1000), pwm, position);
+
+            needle[samples++] = position;
+        }
+
+        delay(NEEDLE_STEP);
+        needleUpdate();
+    }
+
+    CHECK(!needleMoving());
+
+    // against where the move left the PWM, the spline's between the
+    // calibration points
+
+    double end = meterPwm(meter);
+    double move = fabs(end-start);
+    double over = 0;
+    int settled = 0;
+
+    for (int n = 0; n < samples; n++) {
+        if (fabs(needle[n]-end) > BAND*move)
+            settled = n+1;
+        over = fmax(over, (needle[n]-end)*(end > start ? 1 : -1));
+    }
+
+    *settle = settled*DT*1000;
+    *overshoot = over/move*100;
+}
+
+int main(int argc, char **argv) {
+    char what[64];
+
+    halLinuxStorage(NULL);
+    halLinuxSimulate("2026-03-02");
+
+    needleFit();
+
+    if (argc > 1) {
+        csv = fopen(argv[1], "w");
+        if (csv)
+            fprintf(csv, "move,shaper,ms,pwm,needle\n");
+    }
+
+    printf("meters %.1f Hz damping %.2f\n\n",
+        meterFrequency[NEEDLE_MINUTE]/10.0, meterDamping[NEEDLE_MINUTE]/100.0);
+    printf("%-20s %-6s %10s %10s\n", "move", "shaper", "settle ms", "overshoot");
+
+    for (size_t r = 0; r < RUNS; r++) {
+        const Run *run = &runs[r];
+        const Bounds *bounds = run->duration ? &sweepBounds : &stepBounds;
+        double settle[SHAPE_COUNT];
+        double overshoot[SHAPE_COUNT];
+
+        for (uint8_t shape = 0; shape < SHAPE_COUNT; shape++) {
+            runMove(run, shape, 0, &settle[shape], &overshoot[shape]);
+            printf("%-20s %-6s %10.0f %9.1f%%\n", shape ? "" : run->title,
+                shape == SHAPE_ZVD ? "ZVD" : shape == SHAPE_ZV ? "ZV" : "none",
+                settle[shape], overshoot[shape]);
+        }
+
+        for (uint8_t shape = SHAPE_ZV; shape < SHAPE_COUNT; shape++) {
+            sprintf(what, "%s shaper %d settle (ms)", run->title, shape);
+            testBound(what, settle[shape], bounds->settle[shape]);
+            sprintf(what, "%s shaper %d overshoot (%%)", run->title, shape);
+            testBound(what, overshoot[shape], bounds->overshoot[shape]);
+        }
+
+        // a step rings unshaped and the shapers settle it sooner
+
+        if (!run->duration) {
+            CHECK(overshoot[SHAPE_NONE] > RINGING);
+            CHECK(settle[SHAPE_ZV] < settle[SHAPE_NONE]/2);
+            CHECK(settle[SHAPE_ZVD] < settle[SHAPE_NONE]);
+        }
+    }
+
+    // a minute step on a meter 15% either side of its setting
+
+    printf("\n");
+    for (int sign = -1; sign <= 1; sign += 2) {
+        double settle;
+        double overshoot[SHAPE_COUNT];
+
+        for (uint8_t shape = SHAPE_ZV; shape < SHAPE_COUNT; shape++) {
+            runMove(&runs[0], shape, sign*0.15f, &settle, &overshoot[shape]);
+            sprintf(what, "meter %+d%% shaper %d overshoot (%%)", sign*15, shape);
+            testBound(what, overshoot[shape], offOvershoot[shape]);
+        }
+
+        CHECK(overshoot[SHAPE_ZVD] < overshoot[SHAPE_ZV]);
+    }
+
+    if (csv)
+        fclose(csv);
+
+    return testResult();
+}
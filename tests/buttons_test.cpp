@@ -0,0 +1,119 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The adjust buttons, pressed through the simulated hardware with the
+// sketch on the virtual clock.
+//
+// Each press bounces open for a timer step just after first contact.
+// A tap should step the time once, a held minute button should repeat
+// and speed up as buttons.h says, and the RTC should only be written
+// once each button is let go, without the loop ever waiting in delay().
+//
+
+#include "hal.h"
+#include "config.h"
+#include "needle.h"
+#include "buttons.h"
+#include "softclock.h"
+#include "test.h"
+
+static int steps;                   // times the time stepped
+static int sizes[3];                // of 1, 5 and 15 minutes
+static unsigned long firstStep;     // ms after first contact of the first
+
+static void runUntil(unsigned long ms, unsigned long contact) {
+    while (millis() < ms) {
+        int before = theTime.hour*60+theTime.minute;
+
+        loop();
+
+        int step = theTime.hour*60+theTime.minute-before;
+
+        if (step) {
+            if (!steps++)
+                firstStep = millis()-contact;
+            sizes[step >= 15 ? 2 : (step >= 5 ? 1 : 0)]++;
+        }
+    }
+}
+
+//
+// press a button for a number of ms, let it go and wait a second,
+// returning the RTC writes it made, none of them while it was held
+//
+
+static long press(bool *button, unsigned long ms) {
+    long writes = softClockStats.writes;
+    unsigned long contact = millis();
+
+    steps = 0;
+    memset(sizes, 0, sizeof(sizes));
+
+    *button = true;
+    runUntil(contact+NEEDLE_STEP, contact);
+    *button = false;
+    runUntil(contact+2*NEEDLE_STEP, contact);
+    *button = true;
+    runUntil(contact+ms, contact);
+    CHECK(softClockStats.writes == writes);
+
+    *button = false;
+    runUntil(millis()+1000, contact);
+
+    return softClockStats.writes-writes;
+}
+
+int main() {
+    halLinuxStorage(NULL);
+    halLinuxSimulate("2026-03-02");
+
+    setup();
+
+    unsigned long delayed = halLinuxDelayed;
+
+    loop();
+    CHECK(theTime.hour == 0 && theTime.minute == 0);
+
+    // a tap steps a minute once the contact has settled for the debounce
+
+    CHECK(press(&halLinuxMinutePressed, 100) == 1);
+    printf("tap, %d step %lu ms after first contact\n", steps, firstStep);
+    CHECK(steps == 1);
+    CHECK(firstStep >= 2*NEEDLE_STEP+BUTTON_DEBOUNCE);
+    CHECK(firstStep <= 2*NEEDLE_STEP+BUTTON_DEBOUNCE+NEEDLE_STEP);
+    CHECK(theTime.hour == 0 && theTime.minute == 1);
+
+    // held for 6 s, the press and 22 repeats up to the release being
+    // debounced. The press and the first repeats step 1 minute, the next
+    // BUTTON_ACCELERATE to the next 5, the first of them from 00:09 to
+    // 00:10, and the rest to the next 15, from 00:01 to 02:30.
+
+    CHECK(press(&halLinuxMinutePressed, 6000) == 1);
+    printf("6 s hold, %d steps of 1, %d of 5 and %d of 15 minutes to %02d:%02d\n",
+        sizes[0], sizes[1], sizes[2], theTime.hour, theTime.minute);
+    CHECK(steps == 23);
+    CHECK(sizes[0] == BUTTON_ACCELERATE+1);
+    CHECK(sizes[1] == BUTTON_ACCELERATE-1);
+    CHECK(sizes[2] == 7);
+    CHECK(theTime.hour == 2 && theTime.minute == 30);
+
+    // the hour button steps an hour
+
+    CHECK(press(&halLinuxHourPressed, 200) == 1);
+    CHECK(steps == 1);
+    CHECK(theTime.hour == 3 && theTime.minute == 30);
+
+    // the RTC has the new time, and nothing waited
+
+    DateTime rtc = halClockNow();
+
+    CHECK(rtc.hour() == 3 && rtc.minute() == 30);
+    CHECK(halLinuxDelayed == delayed);
+
+    return testResult();
+}
@@ -0,0 +1,119 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// clockTimeTo() carrying the fields on against clockTimeSet() working
+// them out from scratch.
+//
+// Every second from the end of 2023 through the start of 2025, a leap
+// year with both its year ends, then random steps over 2000-2099 of up
+// to a few days either way, so the carries, the steps of just under and
+// over a day and the backward steps are all taken. Both are timed at a
+// second a step.
+//
+
+#include <time.h>
+
+#include "hal.h"
+#include "clocktime.h"
+#include "test.h"
+
+#define RANDOM_STEPS 10000000L
+
+static volatile uint8_t sink;
+
+static bool same(const ClockTime *a, const ClockTime *b) {
+    return a->seconds == b->seconds && a->year == b->year && a->month == b->month &&
+        a->day == b->day && a->hour == b->hour && a->minute == b->minute &&
+        a->second == b->second && a->dayOfWeek == b->dayOfWeek;
+}
+
+static double nanoseconds() {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec*1e9+now.tv_nsec;
+}
+
+int main() {
+    ClockTime carried;
+    ClockTime exact;
+    long errors = 0;
+
+    // every second, a tick at a time
+
+    uint32_t from = DateTime(2023, 12, 31).unixtime();
+    uint32_t to = DateTime(2025, 1, 2).unixtime();
+
+    clockTimeSet(&carried, from);
+    for (uint32_t seconds = from+1; seconds < to; seconds++) {
+        clockTimeTo(&carried, seconds);
+        clockTimeSet(&exact, seconds);
+
+        if (!same(&carried, &exact) && errors++ < 5)
+            printf("  %lu carried to %04d-%02d-%02d %02d:%02d:%02d\n", (unsigned long)seconds,
+                carried.year, carried.month, carried.day, carried.hour, carried.minute, carried.second);
+    }
+    printf("%lu seconds a tick at a time, %ld wrong\n", (unsigned long)(to-from-1), errors);
+    CHECK(errors == 0);
+
+    // random steps of up to 200000 s, a quarter of them back and any that
+    // would leave 2000-2099 turned round
+
+    uint32_t first = DateTime(2000, 1, 1).unixtime();
+    uint32_t last = DateTime(2099, 12, 28).unixtime();
+    uint32_t seed = 1;
+    uint32_t seconds = first;
+    long back = 0;
+
+    errors = 0;
+    clockTimeSet(&carried, seconds);
+
+    for (long n = 0; n < RANDOM_STEPS; n++) {
+        seed = seed*1103515245+12345;
+
+        uint32_t r = seed >> 8;
+        long step = (r & 3) ? (long)(r >> 2) % 200000 : -(long)((r >> 2) % 200000);
+
+        if (seconds+step < first || seconds+step > last)
+            step = -step;
+        if (step < 0)
+            back++;
+
+        seconds += step;
+        clockTimeTo(&carried, seconds);
+        clockTimeSet(&exact, seconds);
+
+        if (!same(&carried, &exact))
+            errors++;
+    }
+    printf("%ld random steps, %ld back, %ld wrong\n", RANDOM_STEPS, back, errors);
+    CHECK(errors == 0);
+
+    // a second a step, carried and from scratch
+
+    double start = nanoseconds();
+
+    for (uint32_t tick = from; tick < to; tick++) {
+        clockTimeTo(&carried, tick);
+        sink = carried.second;
+    }
+
+    double carryTime = (nanoseconds()-start)/(to-from);
+
+    start = nanoseconds();
+    for (uint32_t tick = from; tick < to; tick++) {
+        clockTimeSet(&exact, tick);
+        sink = exact.second;
+    }
+
+    double setTime = (nanoseconds()-start)/(to-from);
+
+    printf("\nclockTimeTo %.1f ns a tick, clockTimeSet %.1f ns\n", carryTime, setTime);
+
+    return testResult();
+}
@@ -0,0 +1,271 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The settings record in EEPROM, loaded by configLoad() as at power up.
+//
+// A valid record should load as it was saved and leave the EEPROM
+// alone. One with any bit flipped, another version or a bad CRC should
+// be put back to the defaults and written out again valid. Settings in
+// the version 0 layout at the bottom of the EEPROM should be carried
+// forward into a record, and then load from it.
+//
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hal.h"
+#include "config.h"
+#include "tz.h"
+#include "test.h"
+
+#define STORAGE_SIZE 1024   // ATmega32U4 EEPROM
+
+static ConfigRecord defaults;
+static ConfigRecord custom;
+
+// configCreate() prints the calibration tables, kept off the results
+
+static int console = -1;
+
+static void quiet(bool on) {
+    fflush(stdout);
+
+    if (on) {
+        int null = open("/dev/null", O_WRONLY);
+
+        console = dup(STDOUT_FILENO);
+        dup2(null, STDOUT_FILENO);
+        close(null);
+    } else {
+        dup2(console, STDOUT_FILENO);
+        close(console);
+    }
+}
+
+//
+// CRC-16/CCITT a bit at a time, as the polynomial has it
+//
+
+static uint16_t crcBits(const ConfigRecord *record) {
+    const uint8_t *bytes = (const uint8_t *)record;
+    uint16_t crc = 0xffff;
+
+    for (size_t n = 0; n < offsetof(ConfigRecord, crc); n++) {
+        crc ^= bytes[n] << 8;
+        for (int bit = 0; bit < 8; bit++)
+            crc = crc & 0x8000 ? (crc << 1)^0x1021 : crc << 1;
+    }
+
+    return crc;
+}
+
+static ConfigRecord stored() {
+    ConfigRecord record;
+
+    return halStorageGet(EEPROM_CONFIG, record);
+}
+
+static bool storedIs(const ConfigRecord *record) {
+    ConfigRecord now = stored();
+
+    return memcmp(&now, record, sizeof(ConfigRecord)) == 0;
+}
+
+//
+// power up on an EEPROM holding a record, with the settings in RAM back
+// to the defaults as the sketch starts with them
+//
+
+static void powerUp(const ConfigRecord *record) {
+    halStoragePut(EEPROM_CONFIG, defaults);
+    configLoad();
+
+    halStoragePut(EEPROM_CONFIG, *record);
+    configLoad();
+}
+
+int main() {
+    uint8_t before[STORAGE_SIZE];
+    uint8_t after[STORAGE_SIZE];
+
+    halLinuxStorage(NULL);
+
+    // an erased EEPROM gets the defaults, with a CRC that agrees with the
+    // polynomial worked a bit at a time
+
+    quiet(true);
+    configLoad();
+    quiet(false);
+
+    defaults = stored();
+    CHECK(memcmp(defaults.sentinel, "PMC", 3) == 0);
+    CHECK(defaults.version == CONFIG_VERSION);
+    CHECK(defaults.crc == crcBits(&defaults));
+    CHECK(strcmp(aTimeZone, DEFAULT_TIME_ZONE) == 0);
+    CHECK(colorMode == DEFAULT_COLOR_MODE);
+    printf("record %u bytes at %d, defaults CRC %04x\n",
+        (unsigned)sizeof(ConfigRecord), EEPROM_CONFIG, defaults.crc);
+
+    // settings away from the defaults load back as they were saved, and
+    // loading them again writes nothing
+
+    HOURS_CAL[6] += 5;
+    MINUTES_CAL[30] -= 7;
+    colorMode = MODE_SKY;
+    r = 1;
+    g = 2;
+    b = 3;
+    turbiditySetting = 30;
+    sweepTime = 25;
+    sweepEasing = 1;
+    glide = GLIDE_HOUR | GLIDE_MINUTE;
+    shaper = 0;
+    meterFrequency[1] = 22;
+    meterDamping[0] = 45;
+    strcpy(aLatitude, "-33.8688");
+    strcpy(aLongitude, "151.2093");
+    strcpy(aTimeZone, "AEST-10AEDT,M10.1.0,M4.1.0/3");
+    configWrite();
+
+    custom = stored();
+    CHECK(custom.crc == crcBits(&custom));
+
+    quiet(true);
+    powerUp(&custom);
+    quiet(false);
+
+    CHECK(HOURS_CAL[6] == defaults.hoursCal[6]+5);
+    CHECK(MINUTES_CAL[30] == defaults.minutesCal[30]-7);
+    CHECK(colorMode == MODE_SKY && r == 1 && g == 2 && b == 3);
+    CHECK(turbiditySetting == 30 && sweepTime == 25 && sweepEasing == 1);
+    CHECK(glide == (GLIDE_HOUR | GLIDE_MINUTE) && shaper == 0);
+    CHECK(meterFrequency[1] == 22 && meterDamping[0] == 45);
+    CHECK(latitude < -33.8f && longitude > 151.2f);
+    CHECK(tzStandardOffset() == 600);
+
+    halStorageReadBlock(0, before, sizeof(before));
+    configLoad();
+    halStorageReadBlock(0, after, sizeof(after));
+    CHECK(memcmp(before, after, sizeof(before)) == 0);
+
+    // any bit flipped puts the defaults back
+
+    long wrong = 0;
+
+    quiet(true);
+    for (size_t bit = 0; bit < sizeof(ConfigRecord)*8; bit++) {
+        ConfigRecord flipped = custom;
+
+        ((uint8_t *)&flipped)[bit/8] ^= 1 << (bit % 8);
+        powerUp(&flipped);
+
+        if (!storedIs(&defaults) || colorMode != DEFAULT_COLOR_MODE)
+            wrong++;
+    }
+    quiet(false);
+
+    printf("%u bits flipped one at a time, %ld not put back to the defaults\n",
+        (unsigned)sizeof(ConfigRecord)*8, wrong);
+    CHECK(wrong == 0);
+
+    // as does another version, even with its CRC right, or a bad CRC
+
+    ConfigRecord version = custom;
+
+    version.version = CONFIG_VERSION+1;
+    version.crc = crcBits(&version);
+
+    ConfigRecord crc = custom;
+
+    crc.crc++;
+
+    quiet(true);
+    powerUp(&version);
+    quiet(false);
+    CHECK(storedIs(&defaults));
+
+    quiet(true);
+    powerUp(&crc);
+    quiet(false);
+    CHECK(storedIs(&defaults));
+
+    // a version 0 EEPROM, as the clock saved its settings before the
+    // record, with the record area erased. The settings added since
+    // should take their defaults, not what was left in RAM.
+
+    halLinuxStorage(NULL);
+
+    turbiditySetting = 30;
+    sweepTime = 25;
+    glide = GLIDE_HOUR | GLIDE_MINUTE;
+    shaper = 0;
+    meterFrequency[0] = 22;
+    meterDamping[1] = 45;
+
+    halStorageWrite(EEPROM_SENTINEL, 'P');
+    halStorageWrite(EEPROM_SENTINEL+1, 'M');
+    halStorageWrite(EEPROM_SENTINEL+2, 'C');
+
+    for (uint8_t hour = 0; hour < 13; hour++)
+        halStorageWrite(EEPROM_HOURS_CAL+hour, hour*20);
+    for (uint8_t minute = 0; minute < 61; minute++)
+        halStoragePut(EEPROM_MINUTES_CAL+minute*2, (uint16_t)(minute*16));
+
+    halStorageWrite(EEPROM_COLOR_MODE, MODE_FIXED);
+    halStorageWrite(EEPROM_NEOPIXEL_R, 10);
+    halStorageWrite(EEPROM_NEOPIXEL_G, 20);
+    halStorageWrite(EEPROM_NEOPIXEL_B, 30);
+    halStoragePut(EEPROM_GMT_OFFSET, (int8_t)-5);
+    halStorageWrite(EEPROM_DST_OBS, 1);
+    halStorageWriteBlock(EEPROM_LATITUDE, "40.7128", 8);
+    halStorageWriteBlock(EEPROM_LONGITUDE, "-74.0060", 9);
+
+    configLoad();
+
+    ConfigRecord migrated = stored();
+
+    printf("version 0 carried forward, time zone %s\n", aTimeZone);
+    CHECK(memcmp(migrated.sentinel, "PMC", 3) == 0);
+    CHECK(migrated.version == CONFIG_VERSION);
+    CHECK(migrated.crc == crcBits(&migrated));
+    CHECK(HOURS_CAL[12] == ((240 << 2) | (240 >> 6)) << METER_FRACTION_BITS);
+    CHECK(MINUTES_CAL[60] == 60*16 << METER_FRACTION_BITS);
+    CHECK(colorMode == MODE_FIXED && r == 10 && g == 20 && b == 30);
+    CHECK(turbiditySetting == DEFAULT_TURBIDITY);
+    CHECK(sweepTime == DEFAULT_SWEEP_TIME && glide == DEFAULT_GLIDE);
+    CHECK(shaper == DEFAULT_SHAPER && meterFrequency[0] == DEFAULT_FREQUENCY);
+    CHECK(meterDamping[1] == DEFAULT_DAMPING);
+    CHECK(strcmp(aTimeZone, "STD5DST,M3.2.0,M11.1.0") == 0);
+    CHECK(tzStandardOffset() == -300);
+    CHECK(strcmp(aLatitude, "40.7128") == 0);
+
+    // then loads from the record, leaving the EEPROM as it is
+
+    halStorageReadBlock(0, before, sizeof(before));
+    configLoad();
+    halStorageReadBlock(0, after, sizeof(after));
+    CHECK(memcmp(before, after, sizeof(before)) == 0);
+    CHECK(storedIs(&migrated));
+    CHECK(colorMode == MODE_FIXED);
+
+    // a load at power up
+
+    struct timespec start, end;
+    const int loads = 10000;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int n = 0; n < loads; n++)
+        configLoad();
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    printf("\nconfigLoad %.1f us\n",
+        ((end.tv_sec-start.tv_sec)*1e9+(end.tv_nsec-start.tv_nsec))/loads/1000);
+
+    return testResult();
+}
@@ -0,0 +1,105 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The meter dither in hal.h, halDitherNext() picking each PWM period's
+// count, for every one of the 32768 values the minute meter can be set
+// to and every fraction a change of value can leave carried over.
+//
+// Every 16 periods in a row should add up to exactly the value, the
+// average since the value was set should be within 15/16 of a count
+// over the periods it has run, and through a meter modelled as a first
+// order lag of 100 ms, the ripple the needle is left with should be
+// under a third of the 1/16 of a count the dither adds.
+//
+
+#include "hal.h"
+#include "test.h"
+
+#define VALUES 32768L
+#define PERIODS 64
+
+#define MINUTE_PWM_HZ 489.0
+#define METER_LAG 0.1       // s
+
+int main() {
+    double pull = 1-exp(-1/(MINUTE_PWM_HZ*METER_LAG));
+    double worstAverage = 0;
+    double worstRipple = 0;
+    long windowsWrong = 0;
+
+    for (long value = 0; value < VALUES; value++) {
+        for (uint8_t error = 0; error <= METER_FRACTION; error++) {
+            HalDither dither = { (uint16_t)value, error };
+            uint16_t counts[PERIODS];
+            long sum = 0;
+
+            for (int n = 0; n < PERIODS; n++) {
+                counts[n] = halDitherNext(&dither);
+                sum += counts[n];
+
+                // each 16 periods adds up to the value in 1/16ths
+
+                if (n >= METER_FRACTION) {
+                    long window = 0;
+
+                    for (int k = n-METER_FRACTION; k <= n; k++)
+                        window += counts[k];
+                    if (window != value)
+                        windowsWrong++;
+                }
+
+                // from the first 16 periods on, the average so far
+
+                if (n >= METER_FRACTION)
+                    testWorst(&worstAverage, (double)sum/(n+1)-value/16.0);
+            }
+
+            // the meter settled on the value, then driven through the
+            // periods again, the ripple peak to peak
+
+            double needle = value/16.0;
+            double low = needle;
+            double high = needle;
+
+            for (int pass = 0; pass < 4; pass++) {
+                for (int n = 0; n < PERIODS; n++) {
+                    needle += (counts[n]-needle)*pull;
+                    if (pass == 3) {
+                        low = fmin(low, needle);
+                        high = fmax(high, needle);
+                    }
+                }
+            }
+
+            testWorst(&worstRipple, high-low);
+        }
+    }
+
+    printf("%ld values from each carried fraction, %ld 16 period windows wrong\n",
+        VALUES, windowsWrong);
+    CHECK(windowsWrong == 0);
+
+    testBound("average from 16 periods on (counts)", worstAverage, 15/256.0);
+    testBound("ripple at the needle (counts)", worstRipple, 0.02);
+
+    // without a fraction the count is the value's, every period
+
+    long dithered = 0;
+
+    for (long value = 0; value < VALUES; value += 1 << METER_FRACTION_BITS) {
+        HalDither dither = { (uint16_t)value, 0 };
+
+        for (int n = 0; n < PERIODS; n++) {
+            if (halDitherNext(&dither) != value >> METER_FRACTION_BITS)
+                dithered++;
+        }
+    }
+    CHECK(dithered == 0);
+
+    return testResult();
+}
@@ -0,0 +1,159 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The approximations in fastmath.h against libm in double precision,
+// swept over the ranges their errors are given for there, and timed
+// against the float libm routines they stand in for.
+//
+
+#include <time.h>
+
+#include "hal.h"
+#include "fastmath.h"
+#include "test.h"
+
+#define SAMPLES 2000000L
+
+static volatile float sink;
+
+// the input for the n'th of SAMPLES steps from low to high
+
+static float sample(long n, double low, double high) {
+    return low+(high-low)*n/(SAMPLES-1);
+}
+
+static double nanoseconds() {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec*1e9+now.tv_nsec;
+}
+
+//
+// nanoseconds a call to each over the range
+//
+
+static void timeCall(const char *what, float (*fast)(float), float (*libm)(float), double low, double high) {
+    double start = nanoseconds();
+    float sum = 0;
+
+    for (long n = 0; n < SAMPLES; n++)
+        sum += fast(sample(n, low, high));
+
+    double fastTime = (nanoseconds()-start)/SAMPLES;
+
+    start = nanoseconds();
+    for (long n = 0; n < SAMPLES; n++)
+        sum += libm(sample(n, low, high));
+
+    double libmTime = (nanoseconds()-start)/SAMPLES;
+
+    sink = sum;
+    printf("%-8s %6.1f ns, libm %6.1f ns\n", what, fastTime, libmTime);
+}
+
+static float callExp(float x) { return fast_exp(x); }
+static float callSin(float x) { return fast_sin(x); }
+static float callCos(float x) { return fast_cos(x); }
+static float libmExp(float x) { return expf(x); }
+static float libmSin(float x) { return sinf(x); }
+static float libmCos(float x) { return cosf(x); }
+static float libmTan(float x) { return tanf(x); }
+static float libmAcos(float x) { return acosf(x); }
+static float libmGamma(float x) { return powf(x, 1/1.8f); }
+
+int main() {
+    double worst;
+
+    // exp(), relative error for -87 < x < 88
+
+    worst = 0;
+    for (long n = 0; n < SAMPLES; n++) {
+        float x = sample(n, -87, 88);
+        double exact = exp((double)x);
+
+        testWorst(&worst, (fast_exp(x)-exact)/exact);
+    }
+    testBound("fast_exp relative, -87..88", worst, 2.6e-7);
+
+    CHECK(fast_exp(-88) == 0);
+    CHECK(isinf(fast_exp(89)));
+    CHECK(fast_exp(0) == 1);
+
+    // sin() and cos(), absolute error for |x| < 100
+
+    worst = 0;
+    for (long n = 0; n < SAMPLES; n++) {
+        float x = sample(n, -100, 100);
+
+        testWorst(&worst, fast_sin(x)-sin((double)x));
+    }
+    testBound("fast_sin absolute, |x| < 100", worst, 1.8e-7);
+
+    worst = 0;
+    for (long n = 0; n < SAMPLES; n++) {
+        float x = sample(n, -100, 100);
+
+        testWorst(&worst, fast_cos(x)-cos((double)x));
+    }
+    testBound("fast_cos absolute, |x| < 100", worst, 1.8e-7);
+
+    // tan(), relative error for |x| < 0.3, the range calc_Yz() uses
+
+    worst = 0;
+    for (long n = 0; n < SAMPLES; n++) {
+        float x = sample(n, -0.3, 0.3);
+        double exact = tan((double)x);
+
+        if (x != 0)
+            testWorst(&worst, (fast_tan(x)-exact)/exact);
+    }
+    testBound("fast_tan relative, |x| < 0.3", worst, 2.6e-7);
+
+    // acos(), absolute error for -1 <= x <= 1
+
+    worst = 0;
+    for (long n = 0; n < SAMPLES; n++) {
+        float x = sample(n, -1, 1);
+
+        testWorst(&worst, fast_acos(x)-acos((double)x));
+    }
+    testBound("fast_acos absolute, -1..1", worst, 3.3e-7);
+
+    // gamma, absolute error in RGB888 steps above 0.1 and over the
+    // whole range, the worst being in the first 1/256
+
+    double above = 0;
+
+    worst = 0;
+    for (long n = 0; n < SAMPLES; n++) {
+        float x = sample(n, 0, 1);
+        double error = (fast_gamma(x)-pow((double)x, 1/1.8))*255;
+
+        testWorst(&worst, error);
+        if (x >= 0.1f)
+            testWorst(&above, error);
+    }
+    testBound("fast_gamma RGB888 steps, 0.1..1", above, 0.004);
+    testBound("fast_gamma RGB888 steps, 0..1", worst, 2.5);
+
+    CHECK(fast_gamma(-0.5f) == 0);
+    CHECK(fast_gamma(0) == 0);
+    CHECK(fast_gamma(1) == 1);
+    CHECK(fast_gamma(1.5f) == 1);
+
+    printf("\n");
+    timeCall("exp", callExp, libmExp, -87, 88);
+    timeCall("sin", callSin, libmSin, -100, 100);
+    timeCall("cos", callCos, libmCos, -100, 100);
+    timeCall("tan", fast_tan, libmTan, -0.3, 0.3);
+    timeCall("acos", fast_acos, libmAcos, -1, 1);
+    timeCall("gamma", fast_gamma, libmGamma, 0, 1);
+
+    return testResult();
+}
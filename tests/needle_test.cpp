@@ -0,0 +1,171 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The needle animation, on the virtual clock.
+//
+// Each easing curve sweeps the minute meter back from 60 to 0 with and
+// without the shapers, which should only ever move it down, reach 0 on
+// time and, unshaped, be where the curve puts it halfway. Then the
+// sketch runs through 12 o'clock, where both meters sweep back, to
+// check it never waits in delay() and that the colour wheel keeps
+// stepping every 100 ms through the sweeps.
+//
+
+#include "hal.h"
+#include "config.h"
+#include "needle.h"
+#include "test.h"
+
+#define SWEEP 1000      // ms
+
+// the longest the shaper can hold a move up, a whole period at the
+// meter's frequency in tenths of a Hz, with room for the damping
+
+static unsigned long shaperSpan() {
+    return 2*10000UL/meterFrequency[NEEDLE_MINUTE];
+}
+
+static void checkSweep(uint8_t easing, uint8_t shape) {
+    char what[64];
+
+    shaper = shape;
+    needleShape();
+
+    needleMove(NEEDLE_MINUTE, NEEDLE_POSITION(60), 0, EASE_LINEAR);
+    while (needleUpdate())
+        delay(NEEDLE_STEP);
+    CHECK(halLinuxMinuteMeter == MINUTES_CAL[60]);
+
+    unsigned long start = millis();
+    uint16_t last = halLinuxMinuteMeter;
+    uint16_t half = 0;
+    bool down = true;
+
+    needleMove(NEEDLE_MINUTE, 0, SWEEP, easing);
+
+    while (needleMoving()) {
+        delay(NEEDLE_STEP);
+        needleUpdate();
+
+        if (halLinuxMinuteMeter > last)
+            down = false;
+        last = halLinuxMinuteMeter;
+
+        if (millis()-start == SWEEP/2)
+            half = halLinuxMinuteMeter;
+    }
+
+    unsigned long took = millis()-start;
+
+    sprintf(what, "easing %d shaper %d sweep (ms)", easing, shape);
+    testBound(what, took, SWEEP+(shape == SHAPE_NONE ? 0 : shaperSpan()));
+
+    CHECK(down);
+    CHECK(took >= SWEEP);
+    CHECK(halLinuxMinuteMeter == MINUTES_CAL[0]);
+
+    // halfway a linear sweep is at 30, the others most of the way down,
+    // 1-(1-t)^3 at 7.5 and the damped spring at 7.8
+
+    if (shape == SHAPE_NONE) {
+        if (easing == EASE_LINEAR)
+            CHECK(half == MINUTES_CAL[30]);
+        else
+            CHECK(half > MINUTES_CAL[5] && half < MINUTES_CAL[10]);
+    }
+}
+
+//
+// run the sketch until a number of ms into the simulation, counting the
+// wheel's steps
+//
+
+static long wheelSteps;
+
+static void runUntil(unsigned long ms) {
+    while (millis() < ms) {
+        uint32_t pixel = halLinuxPixels[0];
+
+        loop();
+
+        if (halLinuxPixels[0] != pixel)
+            wheelSteps++;
+    }
+}
+
+int main() {
+    uint8_t saved = shaper;
+
+    halLinuxStorage(NULL);
+    halLinuxSimulate("2026-03-02");
+
+    needleFit();
+
+    for (uint8_t easing = 0; easing < EASE_COUNT; easing++) {
+        for (uint8_t shape = 0; shape < SHAPE_COUNT; shape++)
+            checkSweep(easing, shape);
+    }
+
+    shaper = saved;
+
+    // the sketch from 11:30, the wheel stepping every 100 ms
+
+    unsigned long begin = millis();
+
+    halLinuxSimulate("2026-03-02T11:30:00");
+
+    setup();
+    CHECK(colorMode == MODE_WHEEL);
+
+    unsigned long delayed = halLinuxDelayed;
+
+    // the hour gliding on to 12, the minute on the spline within a count
+    // of its calibration, then both sweeping back at 12:00 a step at a time
+
+    runUntil(begin+(29*60+59)*1000UL);
+    CHECK(halLinuxHourMeter > HOURS_CAL[11]);
+    CHECK(abs(halLinuxMinuteMeter-MINUTES_CAL[59]) < 16);
+
+    uint16_t hour = halLinuxHourMeter;
+    uint16_t minute = halLinuxMinuteMeter;
+    int hourSteps = 0;
+    int minuteSteps = 0;
+    bool down = true;
+
+    while (millis() < begin+(30*60+5)*1000UL) {
+        runUntil(millis()+1);
+
+        if (halLinuxHourMeter < hour)
+            hourSteps++;
+        if (halLinuxMinuteMeter < minute)
+            minuteSteps++;
+        if (halLinuxHourMeter > hour || halLinuxMinuteMeter > minute)
+            down = false;
+
+        hour = halLinuxHourMeter;
+        minute = halLinuxMinuteMeter;
+    }
+
+    printf("sweeps back on the hour, %d hour and %d minute steps\n", hourSteps, minuteSteps);
+    CHECK(down);
+    CHECK(hourSteps >= 40);
+    CHECK(minuteSteps >= 40);
+    CHECK(halLinuxHourMeter == HOURS_CAL[0]);
+    CHECK(halLinuxMinuteMeter == MINUTES_CAL[0]);
+
+    // on to 12:30, an hour of the wheel give or take the step the hour
+    // starts on
+
+    runUntil(begin+3600*1000UL);
+
+    printf("wheel steps in an hour %ld, delay() %lu ms\n", wheelSteps, halLinuxDelayed-delayed);
+    CHECK(abs(wheelSteps-36000) <= 1);
+    CHECK(halLinuxDelayed == delayed);
+
+    return testResult();
+}
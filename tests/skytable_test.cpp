@@ -0,0 +1,72 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The sky colour table in skytabledata.h against the Perez model in
+// colourcalc.cpp it stands in for, gamma corrected as the analytic
+// calcPixelColor() does, with the sketch's sky_angle.
+//
+// Every tenth of turbidity the table holds is checked at every 16th
+// binary angle of the solar zenith from 0 to 180 degrees, for both
+// views, separately with the sun up. A table built for another sky
+// angle, zenith unit or step count than the sketch uses is well outside
+// the bounds, which are what tools/skytable.py reports for the table it
+// writes with a little room for the model running in float.
+//
+
+#include "hal.h"
+#include "colourcalc.h"
+#include "skytable.h"
+#include "skytabledata.h"
+#include "config.h"
+#include "test.h"
+
+#define ZENITH_STEP 16      // of 32768 to 180 degrees
+#define SUN_UP 16384        // 90 degrees
+
+#define SUN_BOUND 8         // RGB888 steps
+#define SKY_BOUND 20
+#define SUN_UP_BOUND 5
+
+extern float sky_angle;
+
+static perez model;
+
+int main() {
+    double worst[2] = { 0, 0 };
+    double worstUp = 0;
+
+    for (uint8_t turbidity = TURBIDITY_MIN; turbidity <= TURBIDITY_MAX; turbidity++) {
+        for (uint8_t view = SKY_VIEW_SUN; view <= SKY_VIEW_SKY; view++) {
+            float angle = view == SKY_VIEW_SKY ? sky_angle-(M_PI/2) : sky_angle;
+
+            for (long zenith = 0; zenith < 32768; zenith += ZENITH_STEP) {
+                RGB_value exact = model.calc_RGB_out(zenith*(M_PI/32768), angle, turbidity/10.0f);
+                float channels[3] = { exact.R, exact.G, exact.B };
+                uint8_t rgb[3];
+
+                skyTableLookup(view, turbidity, zenith, rgb);
+
+                for (int n = 0; n < 3; n++) {
+                    double error = rgb[n]-255*pow(fmax(channels[n], 0), 1/1.8);
+
+                    testWorst(&worst[view], error);
+                    if (zenith < SUN_UP)
+                        testWorst(&worstUp, error);
+                }
+            }
+        }
+    }
+
+    printf("%d zenith steps, %d turbidities\n",
+        1 << SKY_TABLE_BITS, TURBIDITY_MAX-TURBIDITY_MIN+1);
+    testBound("sun view (RGB888 steps)", worst[SKY_VIEW_SUN], SUN_BOUND);
+    testBound("sky view (RGB888 steps)", worst[SKY_VIEW_SKY], SKY_BOUND);
+    testBound("either, sun up (RGB888 steps)", worstUp, SUN_UP_BOUND);
+
+    return testResult();
+}
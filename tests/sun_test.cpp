@@ -0,0 +1,190 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The solar kernel against the NOAA formulas worked in double precision.
+//
+// The zenith angle is checked straight from calcSolarZenithAngle(),
+// from the day's cached ephemeris and from the tracker stepping each
+// second, and the solar noon, over latitudes from 65 south to 65 north
+// and 2000-2099. The bounds are those the kernel was measured to, for
+// the float or fixed point kernel with or without the table, so build
+// this once with each of the defaults, -DSUN_FIXED_POINT=1 and
+// -DSUN_TABLE=0.
+//
+
+#include "hal.h"
+#include "sun.h"
+#include "test.h"
+
+struct Bounds {
+    double zenith;          // degrees, sun up
+    double twilight;        // degrees, zenith up to 120
+    double ephemeris;       // degrees, cached for the day, sun up
+    double tracker;         // degrees, stepped each second, sun up
+    double overhead;        // degrees, cached within a degree of the zenith
+    double noon;            // minutes
+};
+
+// the orbital series then the table, for the float and fixed point
+// kernels. Within a degree of the zenith the float kernel's acos() runs
+// short of precision, the fixed point kernel's haversine doesn't.
+
+static const Bounds bounds[2][2] = {
+    {{ 0.0035, 0.0035, 0.041, 0.041, 0.14, 0.003 },
+     { 0.041, 0.061, 0.045, 0.045, 0.045, 0.028 }},
+    {{ 0.033, 0.033, 0.033, 0.033, 0.14, 0.14 },
+     { 0.059, 0.075, 0.059, 0.059, 0.059, 0.14 }},
+};
+
+//
+// the NOAA spreadsheet's declination and equation of time, degrees and
+// minutes, for minutes from noon UTC on a julian day
+//
+
+static void noaaPosition(long julianDay, double minutes, double *declination, double *eqOfTime) {
+    double julianCentury = (julianDay-2451545+minutes/1440)/36525;
+    double geomMeanLongSun = fmod(280.46646+julianCentury*(36000.76983+julianCentury*0.0003032), 360);
+    double geomMeanAnomSun = 357.52911+julianCentury*(35999.05029-0.0001537*julianCentury);
+    double eccentEarthOrbit = 0.016708634-julianCentury*(0.000042037+0.0000001267*julianCentury);
+
+    double sunEqofCtr = sin(radians(geomMeanAnomSun))*
+        (1.914602-julianCentury*(0.004817+0.000014*julianCentury))+
+        sin(radians(2*geomMeanAnomSun))*(0.019993-0.000101*julianCentury)+
+        sin(radians(3*geomMeanAnomSun))*0.000289;
+
+    double sunAppLong = geomMeanLongSun+sunEqofCtr-0.00569-0.00478*sin(radians(125.04-1934.136*julianCentury));
+    double meanObliqEcliptic = 23+(26+((21.448-julianCentury*(46.815+julianCentury*(0.00059-julianCentury*0.001813))))/60)/60;
+    double obliqCorr = meanObliqEcliptic+0.00256*cos(radians(125.04-1934.136*julianCentury));
+    double varY = tan(radians(obliqCorr/2))*tan(radians(obliqCorr/2));
+
+    *declination = degrees(asin(sin(radians(obliqCorr))*sin(radians(sunAppLong))));
+
+    *eqOfTime = 4*degrees(varY*sin(2*radians(geomMeanLongSun))-
+        2*eccentEarthOrbit*sin(radians(geomMeanAnomSun))+
+        4*eccentEarthOrbit*varY*sin(radians(geomMeanAnomSun))*cos(2*radians(geomMeanLongSun))-
+        0.5*varY*varY*sin(4*radians(geomMeanLongSun))-
+        1.25*eccentEarthOrbit*eccentEarthOrbit*sin(2*radians(geomMeanAnomSun)));
+}
+
+// zenith angle in degrees for seconds past local midnight
+
+static double noaaZenith(double latitude, double longitude, long julianDay, double seconds, int zoneMinutes) {
+    double declination;
+    double eqOfTime;
+
+    noaaPosition(julianDay, seconds/60-720-zoneMinutes, &declination, &eqOfTime);
+
+    double trueSolarTime = fmod(seconds/60+eqOfTime+4*longitude-zoneMinutes+1440, 1440);
+    double hourAngle = trueSolarTime/4-180;
+    double cosZenith = sin(radians(latitude))*sin(radians(declination))+
+        cos(radians(latitude))*cos(radians(declination))*cos(radians(hourAngle));
+
+    return degrees(acos(constrain(cosZenith, -1.0, 1.0)));
+}
+
+// solar noon in minutes past local midnight, as the spreadsheet works it
+// out with the equation of time at local noon
+
+static double noaaNoon(double longitude, long julianDay, int zoneMinutes) {
+    double declination;
+    double eqOfTime;
+
+    noaaPosition(julianDay, -zoneMinutes, &declination, &eqOfTime);
+
+    return 720-4*longitude-eqOfTime+zoneMinutes;
+}
+
+int main() {
+    const Bounds &bound = bounds[SUN_TABLE ? 1 : 0][SUN_FIXED_POINT ? 1 : 0];
+    double zenith = 0;
+    double twilight = 0;
+    double ephemeris = 0;
+    double overhead = 0;
+    double tracker = 0;
+    double noon = 0;
+    long points = 0;
+
+    printf("%s kernel, %s\n", SUN_FIXED_POINT ? "fixed point" : "float",
+        SUN_TABLE ? "table" : "orbital series");
+
+    for (int latitude = -65; latitude <= 65; latitude += 10) {
+        // a longitude off the zone's meridian, the zone rounded from it
+        float longitude = -122.4f+latitude*2.7f;
+        int zoneMinutes = (int)lround(longitude/15)*60;
+
+        for (int year = 2000+(latitude+65)/10; year <= 2099; year += 7) {
+            for (int month = 1; month <= 12; month++) {
+                for (int day = 1; day <= 28; day += 9) {
+                    long julianDay = julianDate(year, month, day);
+                    SolarEphemeris eph;
+
+                    calcSolarEphemeris(&eph, latitude, longitude, year, month, day, zoneMinutes);
+
+                    testWorst(&noon, eph.noon*1440-noaaNoon(longitude, julianDay, zoneMinutes));
+                    testWorst(&noon, calcSolarNoon(latitude, longitude, year, month, day, zoneMinutes)*1440-
+                        noaaNoon(longitude, julianDay, zoneMinutes));
+
+                    for (int minute = 0; minute < 1440; minute += 5) {
+                        double reference = noaaZenith(latitude, longitude, julianDay, minute*60, zoneMinutes);
+                        double error = calcSolarZenithAngle(latitude, longitude, year, month, day,
+                            minute/60, minute%60, zoneMinutes)-reference;
+
+                        if (reference <= 90)
+                            testWorst(&zenith, error);
+                        if (reference <= 120)
+                            testWorst(&twilight, error);
+                        error = calcEphemerisZenithAngle(&eph, minute/60, minute%60)-reference;
+
+                        if (reference <= 1)
+                            testWorst(&overhead, error);
+                        else if (reference <= 90)
+                            testWorst(&ephemeris, error);
+
+                        points++;
+                    }
+                }
+            }
+        }
+    }
+
+    // the tracker a second at a time through a day each season
+
+    for (int latitude = -60; latitude <= 60; latitude += 30) {
+        float longitude = 8.5f+latitude;
+        int zoneMinutes = (int)lround(longitude/15)*60;
+
+        for (int month = 3; month <= 12; month += 3) {
+            long julianDay = julianDate(2031, month, 21);
+            SolarEphemeris eph;
+            SolarTracker track;
+
+            calcSolarEphemeris(&eph, latitude, longitude, 2031, month, 21, zoneMinutes);
+            resetSolarTracker(&track);
+
+            for (long seconds = 0; seconds < 86400; seconds++) {
+                double angle = updateSolarTracker(&track, &eph, seconds);
+                double reference = noaaZenith(latitude, longitude, julianDay, seconds, zoneMinutes);
+
+                if (reference <= 1)
+                    testWorst(&overhead, angle-reference);
+                else if (reference <= 90)
+                    testWorst(&tracker, angle-reference);
+            }
+        }
+    }
+
+    printf("%ld points\n", points);
+    testBound("zenith, sun up (degrees)", zenith, bound.zenith);
+    testBound("zenith, to 120 (degrees)", twilight, bound.twilight);
+    testBound("ephemeris zenith, sun up (degrees)", ephemeris, bound.ephemeris);
+    testBound("tracker zenith, sun up (degrees)", tracker, bound.tracker);
+    testBound("cached zenith, overhead (degrees)", overhead, bound.overhead);
+    testBound("solar noon (minutes)", noon, bound.noon);
+
+    return testResult();
+}
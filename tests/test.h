@@ -0,0 +1,77 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// Checks for the host tests. Each test is a program built with the
+// sketch on the Linux HAL, see the README, that prints what it
+// measured and returns nonzero if a check failed.
+//
+
+#ifndef __TEST_H__
+#define __TEST_H__
+
+#include <math.h>
+#include <stdio.h>
+
+static long testChecks;
+static long testFailures;
+
+//
+// count a check and report it if it failed
+//
+
+#define CHECK(condition) testCheck((condition), #condition, __FILE__, __LINE__)
+
+static inline bool testCheck(bool passed, const char *condition, const char *file, int line) {
+    testChecks++;
+
+    if (!passed) {
+        testFailures++;
+        printf("%s:%d: failed: %s\n", file, line, condition);
+    }
+
+    return passed;
+}
+
+//
+// print the worst error seen against the bound it is documented to keep
+// within, failing if it is over
+//
+
+static inline bool testBound(const char *what, double worst, double bound) {
+    bool passed = worst <= bound;
+
+    testChecks++;
+    printf("%-40s %12.4g  bound %10.4g%s\n", what, worst, bound, passed ? "" : "  FAILED");
+
+    if (!passed)
+        testFailures++;
+
+    return passed;
+}
+
+//
+// keep the worst of a run of errors
+//
+
+static inline void testWorst(double *worst, double error) {
+    error = fabs(error);
+
+    if (error > *worst)
+        *worst = error;
+}
+
+//
+// print the totals, the program's exit status
+//
+
+static inline int testResult() {
+    printf("%ld checks, %ld failed\n", testChecks, testFailures);
+    return testFailures ? 1 : 0;
+}
+
+#endif
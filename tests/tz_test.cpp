@@ -0,0 +1,218 @@
+//
+// Panel Meter Clock by Russ Hughes (russ@owt.com)
+// April 2020
+//
+// Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+//
+
+//
+// The time zone rules against glibc's localtime() with the same TZ
+// string.
+//
+// Every hour of 2000-2099 on the standard time the RTC keeps is checked
+// walking forwards, backwards and in a shuffled order, as tzShift()
+// keeps the stretch of the year its last answer came from, and every
+// minute of the day either side of each transition. tzStandard() should
+// take each local time back to its standard time, the later one in the
+// hour that repeats.
+//
+// The zones cover each kind of date, offsets and DST shifts with minutes,
+// southern rules that end the year on DST and rule times outside the day.
+// Strings that tzSet() can't read should leave the zone as it was.
+//
+
+#include <time.h>
+
+#include "hal.h"
+#include "tz.h"
+#include "test.h"
+
+#define FIRST_YEAR 2000
+#define LAST_YEAR 2099
+
+static uint32_t *hours;
+static long hourCount;
+
+// the minutes east of UTC glibc has for a standard time
+
+static long glibcOffset(uint32_t standard) {
+    time_t utc = (time_t)standard-tzStandardOffset()*60L;
+    struct tm local;
+
+    localtime_r(&utc, &local);
+    return local.tm_gmtoff/60;
+}
+
+// a standard time is wrong if its offset or the way back from its local
+// time are
+
+static bool wrong(uint32_t standard) {
+    int16_t shift = tzShift(standard);
+    uint32_t local = standard+shift*60L;
+    uint32_t back = tzStandard(local);
+
+    if (tzStandardOffset()+shift != glibcOffset(standard))
+        return true;
+
+    return back != standard && !(back > standard && back+tzShift(back)*60L == local);
+}
+
+static long walk(const char *order, long from, long step) {
+    long errors = 0;
+
+    for (long n = 0; n < hourCount; n++) {
+        if (wrong(hours[(from+n*step) % hourCount]))
+            errors++;
+    }
+
+    printf("  %-10s %ld hours wrong\n", order, errors);
+    return errors;
+}
+
+//
+// check a zone, in all three orders if walks is set, or forwards
+//
+
+static void checkZone(const char *tz, bool walks) {
+    uint32_t first = DateTime(FIRST_YEAR, 1, 1).unixtime();
+    long dstHours = 0;
+    long transitions = 0;
+    long minuteErrors = 0;
+
+    setenv("TZ", tz, 1);
+    tzset();
+
+    printf("%s\n", tz);
+    if (!CHECK(tzSet(tz)))
+        return;
+
+    hourCount = (DateTime(LAST_YEAR, 12, 31, 23).unixtime()-first)/3600+1;
+    hours = (uint32_t *)realloc(hours, hourCount*sizeof(uint32_t));
+
+    for (long n = 0; n < hourCount; n++) {
+        hours[n] = first+n*3600;
+
+        if (glibcOffset(hours[n]) != tzStandardOffset())
+            dstHours++;
+    }
+
+    CHECK(walk("forwards", 0, 1) == 0);
+
+    if (walks) {
+        CHECK(walk("backwards", hourCount-1, hourCount-1) == 0);
+
+        // a fixed shuffle so a failure can be run again
+
+        uint32_t seed = 1;
+
+        for (long n = hourCount-1; n > 0; n--) {
+            seed = seed*1103515245+12345;
+
+            long other = (seed >> 8) % (n+1);
+            uint32_t swap = hours[n];
+
+            hours[n] = hours[other];
+            hours[other] = swap;
+        }
+
+        CHECK(walk("shuffled", 0, 1) == 0);
+    }
+
+    // every minute of the day either side of each transition
+
+    for (uint32_t hour = first+3600; hour < first+hourCount*3600UL; hour += 3600) {
+        if (glibcOffset(hour) == glibcOffset(hour-3600))
+            continue;
+
+        transitions++;
+
+        for (uint32_t minute = hour-86400L; minute < hour+86400L; minute += 60) {
+            if (minute >= first && wrong(minute))
+                minuteErrors++;
+        }
+    }
+
+    printf("  %ld of %ld hours shifted, %ld transitions, %ld minutes wrong around them\n",
+        dstHours, hourCount, transitions, minuteErrors);
+    CHECK(minuteErrors == 0);
+}
+
+static const char *zones[] = {
+    "CET-1CEST,M3.5.0,M10.5.0/3",           // central Europe
+    "<+0545>-5:45",                         // Nepal, no DST
+    "AEST-10AEDT,M10.1.0,M4.1.0/3",         // New South Wales
+    "NZST-12NZDT,M9.5.0,M4.1.0/3",          // New Zealand
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0", // Lord Howe, a 30 minute shift
+    "<-02>2<-01>,M3.5.0/-1,M10.5.0/0",      // Greenland, a rule before midnight
+    "EST5EDT,M3.2.0/-2:30,M11.1.0/26",      // rule times either side of the day
+    "<-03>3<-02>,M9.1.6/167,M4.1.0/-167",   // the furthest they go
+    "XST3XDT,J60,J300",                     // Julian days, Feb 29 not counted
+    "XST3XDT,59,299/1:30",                  // zero based days, Feb 29 counted
+    "XST-3XDT-5,J300/4,J60",                // southern, a two hour shift
+};
+
+// strings tzSet() should turn down
+
+static const char *badZones[] = {
+    "",
+    "PST",
+    "PS8",
+    "<>8",
+    "<+05",
+    "<+0 5>5",
+    "PST25",
+    "PST8:60",
+    "PST8PDT,M3.2.0",
+    "PST8PDT,M3.2.0,",
+    "PST8PDT,M0.2.0,M11.1.0",
+    "PST8PDT,M13.2.0,M11.1.0",
+    "PST8PDT,M3.0.0,M11.1.0",
+    "PST8PDT,M3.6.0,M11.1.0",
+    "PST8PDT,M3.2.7,M11.1.0",
+    "PST8PDT,M3.2,M11.1.0",
+    "PST8PDT,J0,J300",
+    "PST8PDT,J366,J300",
+    "PST8PDT,366,300",
+    "PST8PDT,M3.2.0/168,M11.1.0",
+    "PST8PDT,M3.2.0,M11.1.0/",
+    "PST8PDT,M3.2.0,M11.1.0x",
+};
+
+int main() {
+    checkZone("PST8PDT,M3.2.0,M11.1.0", true);
+
+    for (unsigned n = 0; n < sizeof(zones)/sizeof(zones[0]); n++)
+        checkZone(zones[n], n == 2);
+
+    // a dst name without dates takes the US ones
+
+    uint32_t first = DateTime(FIRST_YEAR, 1, 1).unixtime();
+    long differ = 0;
+
+    CHECK(tzSet("EST5EDT"));
+    for (long n = 0; n < hourCount; n++) {
+        int16_t shift = tzShift(first+n*3600);
+
+        tzSet("EST5EDT,M3.2.0,M11.1.0");
+        if (tzShift(first+n*3600) != shift)
+            differ++;
+        tzSet("EST5EDT");
+    }
+    printf("EST5EDT, %ld hours differ from the US rules\n", differ);
+    CHECK(differ == 0);
+
+    // the zone is kept through the strings tzSet() turns down
+
+    CHECK(tzSet("CET-1CEST,M3.5.0,M10.5.0/3"));
+
+    uint32_t summer = DateTime(2026, 7, 1).unixtime();
+
+    for (unsigned n = 0; n < sizeof(badZones)/sizeof(badZones[0]); n++) {
+        if (!CHECK(!tzSet(badZones[n])))
+            printf("  \"%s\" was taken\n", badZones[n]);
+    }
+    CHECK(tzStandardOffset() == 60 && tzShift(summer) == 60);
+
+    free(hours);
+    return testResult();
+}
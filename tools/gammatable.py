@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+#
+# Panel Meter Clock by Russ Hughes (russ@owt.com)
+# April 2020
+#
+# Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+#
+
+"""
+Generate panel_meter_clock2_1/gammatable.h, the PROGMEM table behind
+fast_gamma() in fastmath.cpp, and report its error against pow().
+
+Usage: python3 tools/gammatable.py [steps]
+"""
+
+import os
+import sys
+
+STEPS = int(sys.argv[1]) if len(sys.argv) > 1 else 256
+GAMMA = 1 / 1.8
+
+OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                      '..', 'panel_meter_clock2_1', 'gammatable.h')
+
+
+def build_table():
+    return [round(65535 * (k / STEPS) ** GAMMA) for k in range(STEPS + 1)]
+
+
+def lookup(table, x):
+    """interpolated lookup matching fast_gamma()"""
+    pos = x * STEPS
+    idx = min(int(pos), STEPS - 1)
+    return (table[idx] + (table[idx + 1] - table[idx]) * (pos - idx)) / 65535
+
+
+def report(table):
+    """worst error in RGB888 steps below and above x = 0.1"""
+    low = high = 0
+    for i in range(1, 1000001):
+        x = i / 1000000
+        err = abs(lookup(table, x) - x ** GAMMA) * 255
+        if x < 0.1:
+            low = max(low, err)
+        else:
+            high = max(high, err)
+    return low, high
+
+
+def write_table(table, stats):
+    flash = len(table) * 2
+    with open(OUTPUT, 'w') as out:
+        out.write('//\n')
+        out.write('// Generated by tools/gammatable.py, do not edit.\n')
+        out.write('//\n')
+        out.write('// x^(1/%.1f) at %d steps from 0 to 1 scaled to 65535, %d bytes of flash.\n' % (1 / GAMMA, STEPS, flash))
+        out.write('//\n')
+        out.write('// Worst case error against pow() in RGB888 steps:\n')
+        out.write('//     %.4f below 0.1, %.4f above.\n' % stats)
+        out.write('//\n\n')
+        out.write('#define GAMMA_TABLE_STEPS %d\n\n' % STEPS)
+        out.write('static const uint16_t GAMMA_TABLE_DATA[%d] PROGMEM = {\n' % len(table))
+        for k in range(0, len(table), 8):
+            row = ', '.join('%5d' % v for v in table[k:k + 8])
+            out.write('    %s%s\n' % (row, ',' if k + 8 < len(table) else ''))
+        out.write('};\n')
+    return flash
+
+
+def main():
+    table = build_table()
+    stats = report(table)
+    flash = write_table(table, stats)
+
+    print('%d steps, %d bytes of flash' % (STEPS, flash))
+    print('worst error below 0.1  %.4f RGB888 steps' % stats[0])
+    print('worst error above 0.1  %.4f RGB888 steps' % stats[1])
+    print('wrote %s' % os.path.normpath(OUTPUT))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+#
+# Panel Meter Clock by Russ Hughes (russ@owt.com)
+# April 2020
+#
+# Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+#
+
+"""
+Plot the needle moves tests/ballistics_test.cpp simulates to an SVG file.
+
+The test runs needleMove() and needleUpdate() in
+panel_meter_clock2_1/needle.cpp on the virtual clock, driving a model of
+each meter with the PWM, and given a file name writes every move it
+makes to it as CSV. Each move is plotted in a panel of its own, the
+needle with each shaper over the PWM the HAL was given.
+
+Usage: ./ballistics_test moves.csv
+       python3 tools/needlesim.py moves.csv moves.svg
+"""
+
+import csv
+import sys
+
+SHAPERS = ('none', 'ZV', 'ZVD')
+COLOURS = ('#c03030', '#3060c0', '#30a040')
+
+
+def read_moves(filename):
+    """{move: {shaper: [(ms, pwm, needle)]}} in the order the test made them"""
+    moves = {}
+    with open(filename) as file:
+        for row in csv.DictReader(file):
+            traces = moves.setdefault(row['move'], {})
+            traces.setdefault(int(row['shaper']), []).append(
+                (int(row['ms']), float(row['pwm']), float(row['needle'])))
+    return moves
+
+
+def plot(filename, moves):
+    width, height, margin = 640, 200, 40
+    svg = ['<svg xmlns="http://www.w3.org/2000/svg" width="%d" height="%d" '
+           'font-family="sans-serif" font-size="12">' % (width, len(moves) * height)]
+
+    for row, (title, traces) in enumerate(moves.items()):
+        top = row * height
+        unshaped = traces[min(traces)]
+        start, end = unshaped[0][2], unshaped[-1][1]
+        length = unshaped[-1][0]
+        low, high = min(start, end), max(start, end)
+        span = (high - low) * 1.4
+        bottom = low - (high - low) * 0.2
+
+        def xy(ms, value):
+            return (margin + ms / length * (width - 2 * margin),
+                    top + height - margin / 2 - (value - bottom) / span * (height - margin))
+
+        svg.append('<text x="%d" y="%d">%s</text>' % (margin, top + 16, title))
+        svg.append('<rect x="%d" y="%d" width="%d" height="%d" fill="none" stroke="#999"/>' %
+                   (margin, top + margin / 2, width - 2 * margin, height - margin))
+        for value in (start, end):
+            (x0, y), (x1, _) = xy(0, value), xy(length, value)
+            svg.append('<line x1="%.1f" y1="%.1f" x2="%.1f" y2="%.1f" stroke="#ccc"/>' %
+                       (x0, y, x1, y))
+        for shaper, trace in sorted(traces.items()):
+            for column, dash in ((1, ' stroke-dasharray="2,3"'), (2, '')):
+                points = ' '.join('%.1f,%.1f' % xy(sample[0], sample[column]) for sample in trace)
+                svg.append('<polyline points="%s" fill="none" stroke="%s"%s/>' %
+                           (points, COLOURS[shaper], dash))
+            svg.append('<text x="%d" y="%d" fill="%s">%s</text>' %
+                       (width - margin - 120 + shaper * 40, top + 16, COLOURS[shaper],
+                        SHAPERS[shaper]))
+
+    svg.append('</svg>')
+    with open(filename, 'w') as file:
+        file.write('\n'.join(svg) + '\n')
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: needlesim.py moves.csv moves.svg')
+
+    moves = read_moves(sys.argv[1])
+    plot(sys.argv[2], moves)
+    print('plotted %d moves to %s' % (len(moves), sys.argv[2]))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+#
+# Panel Meter Clock by Russ Hughes (russ@owt.com)
+# April 2020
+#
+# Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+#
+
+"""
+Generate panel_meter_clock2_1/skytabledata.h, the PROGMEM table of sky
+colours used when SKY_TABLE is set in skytable.h.
+
+With the sky angle fixed, the colour perez::calc_RGB_out() returns for the
+sun and sky views depends only on the turbidity and the solar zenith angle.
+The table holds the gamma corrected RGB888 colour for each tenth of
+turbidity the clock allows, at evenly spaced zenith angles from 0 to 180
+degrees, calculated the same way as the analytic path in setPixelColor().
+The error of the interpolated lookup against the analytic model is
+reported. Rerun it if sky_angle or the gamma in panel_meter_clock2_1.ino,
+or the turbidity range in config.h, change.
+
+Usage: python3 tools/skytable.py [steps]
+"""
+
+import math
+import os
+import sys
+
+STEPS = int(sys.argv[1]) if len(sys.argv) > 1 else 64
+TURBIDITY_MIN = 18          # tenths, TURBIDITY_MIN and TURBIDITY_MAX in config.h
+TURBIDITY_MAX = 40
+SKY_ANGLE = 1.309
+GAMMA = 1 / 1.8
+VIEWS = (('sun', SKY_ANGLE), ('sky', SKY_ANGLE - math.pi / 2))
+
+OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                      '..', 'panel_meter_clock2_1', 'skytabledata.h')
+
+
+def perez_coeff(t):
+    """generate_perez_coeff() in colourcalc.cpp, as (A, B, C, D, E) for Y, x and y"""
+    return ((.17872 * t - 1.46303, -.3554 * t + .42749, -.02266 * t + 5.32505,
+             .12064 * t - 2.57705, -.06696 * t + .37027),
+            (-.01925 * t - .25922, -.06651 * t + .00081, -.00041 * t + .21247,
+             -.06409 * t - .89887, -.00325 * t + .04517),
+            (-.01669 * t - .26078, -.09495 * t + .00921, -.00792 * t + .21023,
+             -.04405 * t - 1.65369, -.01092 * t + .05291))
+
+
+def perez_lum(coeff, theta, gamma, n):
+    a, b, c, d, e = coeff[n]
+    theta = math.cos(theta)
+    return (1 + a * math.exp(b / theta)) * (1 + c * math.exp(d * gamma) + e * math.cos(gamma) ** 2)
+
+
+def calc_rgb_out(theta_sun, theta_pixel, t):
+    """perez::calc_RGB_out(), including its integer 4 / 9"""
+    coeff = perez_coeff(t)
+    yz_num = (4.0453 * t - 4.9710) * math.tan((4 // 9 - t / 120) * (math.pi - 2 * theta_sun)) - 0.2155 * t + 2.4192
+    yz_den = (4.0453 * t - 4.9710) * math.tan((4 // 9 - t / 120) * math.pi) - 0.2155 * t + 2.4192
+    s, s2, s3 = theta_sun, theta_sun ** 2, theta_sun ** 3
+    xz = ((0.00166 * s3 - 0.00375 * s2 + 0.00209 * s) * t * t +
+          (-0.02903 * s3 + 0.06377 * s2 - 0.03202 * s + 0.00394) * t +
+          (0.11693 * s3 - 0.21196 * s2 + 0.06052 * s + 0.25886))
+    yz = ((0.00275 * s3 - 0.00610 * s2 + 0.00317 * s) * t * t +
+          (-0.04214 * s3 + 0.08970 * s2 - 0.04153 * s + 0.00516) * t +
+          (0.15346 * s3 - 0.26756 * s2 + 0.06670 * s + 0.26688))
+
+    Y = yz_num / yz_den * perez_lum(coeff, theta_pixel, theta_sun, 0) / perez_lum(coeff, 0, theta_sun, 0)
+    x = xz * perez_lum(coeff, theta_pixel, theta_sun, 1) / perez_lum(coeff, 0, theta_sun, 1)
+    y = yz * perez_lum(coeff, theta_pixel, theta_sun, 2) / perez_lum(coeff, 0, theta_sun, 2)
+
+    X = (x / y) * Y
+    Z = (1 - x - y) / (y * Y)
+
+    rgb = (2.28783849 * X - 0.83336768 * Y - 0.4544708 * Z,
+           -0.51165138 * X + 1.42275838 * Y + 0.08889300 * Z,
+           0.00572041 * X - 0.01590685 * Y + 1.01018641 * Z)
+    divisor = max(1, *rgb)
+    return [v / divisor for v in rgb]
+
+
+def sky_colour(turbidity, zenith, sky_angle):
+    """gamma corrected colour (0-1) for a zenith in radians, as setPixelColor()"""
+    rgb = calc_rgb_out(zenith, sky_angle, turbidity / 10)
+    return [max(v, 0) ** GAMMA for v in rgb]
+
+
+def build_table():
+    """STEPS+1 colours per view from 0 to 180 degrees for each turbidity"""
+    table = []
+    for turbidity in range(TURBIDITY_MIN, TURBIDITY_MAX + 1):
+        views = []
+        for name, angle in VIEWS:
+            rows = []
+            for k in range(STEPS + 1):
+                colour = sky_colour(turbidity, math.pi * k / STEPS, angle)
+                rows.append(tuple(round(255 * v) for v in colour))
+            views.append(rows)
+        table.append(views)
+    return table
+
+
+def lookup(rows, zenith):
+    """integer lookup matching skyTableLookup() in skytable.cpp, zenith a 16 bit binary angle"""
+    shift = 15 - (STEPS.bit_length() - 1)
+    zenith = min(zenith, 32767)
+    idx = zenith >> shift
+    frac = zenith & ((1 << shift) - 1)
+    return [a + (((b - a) * frac + (1 << (shift - 1))) >> shift) for a, b in zip(rows[idx], rows[idx + 1])]
+
+
+def report(table):
+    """worst error in RGB888 steps over the zenith and turbidity, per view"""
+    worst = [0] * len(VIEWS)
+    for turbidity, views in zip(range(TURBIDITY_MIN, TURBIDITY_MAX + 1), table):
+        for v, (rows, (name, angle)) in enumerate(zip(views, VIEWS)):
+            for zenith in range(0, 32768, 16):
+                exact = sky_colour(turbidity, zenith * math.pi / 32768, angle)
+                got = lookup(rows, zenith)
+                worst[v] = max(worst[v], max(abs(g - 255 * e) for g, e in zip(got, exact)))
+    return worst
+
+
+def write_table(table, worst):
+    flash = len(table) * len(VIEWS) * (STEPS + 1) * 3
+    with open(OUTPUT, 'w') as out:
+        out.write('//\n')
+        out.write('// Generated by tools/skytable.py, do not edit.\n')
+        out.write('//\n')
+        out.write('// Gamma corrected sun and sky view colours for turbidity %.1f to %.1f\n' % (TURBIDITY_MIN / 10, TURBIDITY_MAX / 10))
+        out.write('// in tenths, at %d solar zenith angles from 0 to 180 degrees in %d steps\n' % (STEPS + 1, STEPS))
+        out.write('// of %.2f degrees, %d bytes of flash.\n' % (180 / STEPS, flash))
+        out.write('//\n')
+        out.write('// Worst case error against the analytic Perez model:\n')
+        out.write('//     sun %.2f, sky %.2f RGB888 steps.\n' % tuple(worst))
+        out.write('//\n\n')
+        out.write('#define SKY_TABLE_BITS %d\n' % (STEPS.bit_length() - 1))
+        out.write('#define SKY_TABLE_TURBIDITY_MIN %d\n' % TURBIDITY_MIN)
+        out.write('#define SKY_TABLE_TURBIDITY_MAX %d\n\n' % TURBIDITY_MAX)
+        out.write('static const uint8_t SKY_TABLE_DATA[%d][%d][%d][3] PROGMEM = {\n' %
+                  (len(table), len(VIEWS), STEPS + 1))
+        for t, views in enumerate(table):
+            out.write('    {   // %.1f\n' % ((TURBIDITY_MIN + t) / 10))
+            for v, rows in enumerate(views):
+                for k in range(0, len(rows), 4):
+                    row = ', '.join('{%3d, %3d, %3d}' % entry for entry in rows[k:k + 4])
+                    out.write('        %s%s%s\n' % ('{' if k == 0 else ' ', row,
+                              ('},' if v + 1 < len(views) else '}') if k + 4 >= len(rows) else ','))
+            out.write('    }%s\n' % (',' if t + 1 < len(table) else ''))
+        out.write('};\n')
+    return flash
+
+
+def main():
+    if STEPS & (STEPS - 1) or STEPS > 32768:
+        sys.exit('steps must be a power of two')
+
+    table = build_table()
+    worst = report(table)
+    flash = write_table(table, worst)
+
+    print('%d steps, %d entries, %d bytes of flash' % (STEPS, STEPS + 1, flash))
+    for (name, angle), err in zip(VIEWS, worst):
+        print('worst %s view error  %.2f RGB888 steps' % (name, err))
+    print('wrote %s' % os.path.normpath(OUTPUT))
+
+
+if __name__ == '__main__':
+    main()
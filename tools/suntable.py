@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#
+# Panel Meter Clock by Russ Hughes (russ@owt.com)
+# April 2020
+#
+# Shared under the Creative Commons - Attribution - ShareAlike 3.0 license.
+#
+
+"""
+Generate panel_meter_clock2_1/suntabledata.h, the PROGMEM table of solar
+declination and equation of time used when SUN_TABLE is set in sun.h.
+
+Both curves follow the tropical year, so the table is indexed by the sun's
+geometric mean longitude rather than the day of the year, which keeps it in
+step through leap years. Entries are calculated with the full NOAA formulas
+for the year 2050, the middle of the range the clock is expected to run
+over, and the error against the full formulas is reported for 2000-2100.
+
+Usage: python3 tools/suntable.py [entries]
+"""
+
+import math
+import os
+import sys
+
+ENTRIES = int(sys.argv[1]) if len(sys.argv) > 1 else 128
+EPOCH_DAYS = 18262          # 2050-01-01 12:00 UT in days from J2000
+UNITS = 1024                # table units per degree and per minute
+
+# mean longitude as a 32 bit binary angle, matching suntable.h
+
+MEAN_LONG_J2000 = 3346095204
+MEAN_LONG_DAY = 11759231
+MEAN_LONG_MINUTE = 8166
+
+OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                      '..', 'panel_meter_clock2_1', 'suntabledata.h')
+
+
+def julian_date(year, month, day):
+    """Julian day number, as julianDate() in sun.cpp"""
+    a = int((month - 14) / 12)
+    return (day - 32075 + 1461 * (year + 4800 + a) // 4 +
+            367 * (month - 2 - a * 12) // 12 -
+            3 * ((year + 4900 + a) // 100) // 4)
+
+
+def solar_position(days):
+    """NOAA declination (degrees) and equation of time (minutes) at J2000+days"""
+    t = days / 36525
+    rad = math.radians
+    l = math.fmod(280.46646 + t * (36000.76983 + t * 0.0003032), 360)
+    m = 357.52911 + t * (35999.05029 - 0.0001537 * t)
+    e = 0.016708634 - t * (0.000042037 + 0.0000001267 * t)
+    c = (math.sin(rad(m)) * (1.914602 - t * (0.004817 + 0.000014 * t)) +
+         math.sin(rad(2 * m)) * (0.019993 - 0.000101 * t) +
+         math.sin(rad(3 * m)) * 0.000289)
+    app = l + c - 0.00569 - 0.00478 * math.sin(rad(125.04 - 1934.136 * t))
+    eps = (23 + (26 + ((21.448 - t * (46.815 + t * (0.00059 - t * 0.001813)))) / 60) / 60 +
+           0.00256 * math.cos(rad(125.04 - 1934.136 * t)))
+    y = math.tan(rad(eps / 2)) ** 2
+    decl = math.degrees(math.asin(math.sin(rad(eps)) * math.sin(rad(app))))
+    eot = 4 * math.degrees(y * math.sin(2 * rad(l)) - 2 * e * math.sin(rad(m)) +
+                           4 * e * y * math.sin(rad(m)) * math.cos(2 * rad(l)) -
+                           0.5 * y * y * math.sin(4 * rad(l)) -
+                           1.25 * e * e * math.sin(2 * rad(m)))
+    return decl, eot
+
+
+def mean_long(days, minutes):
+    """32 bit binary mean longitude, as computed on the clock"""
+    return (MEAN_LONG_J2000 + days * MEAN_LONG_DAY + minutes * MEAN_LONG_MINUTE) & 0xFFFFFFFF
+
+
+def build_table():
+    """one entry per 1/ENTRIES of the mean longitude, the last repeats the first"""
+    table = []
+    epoch = mean_long(EPOCH_DAYS, 0)
+    for k in range(ENTRIES + 1):
+        step = ((k * (1 << 32) // ENTRIES) - epoch) % (1 << 32)
+        days = EPOCH_DAYS + step / MEAN_LONG_DAY
+        decl, eot = solar_position(days)
+        table.append((round(decl * UNITS), round(eot * UNITS)))
+    return table
+
+
+def lookup(table, days, minutes):
+    """integer lookup matching sunTableLookup() in suntable.cpp"""
+    phase = mean_long(days, minutes)
+    shift = 32 - (ENTRIES.bit_length() - 1)
+    idx = phase >> shift
+    frac = (phase >> (shift - 15)) & 0x7FFF
+    values = []
+    for n in range(2):
+        a = table[idx][n]
+        b = table[idx + 1][n]
+        values.append(a + (((b - a) * frac) >> 15))
+    return values
+
+
+def report(table):
+    """worst case error against the full formulas, hourly over 2000-2100"""
+    worst_decl = worst_eot = worst_angle = 0
+    start = julian_date(2000, 1, 1) - 2451545
+    end = julian_date(2100, 12, 31) - 2451545
+    for days in range(start, end + 1):
+        for hour in range(24):
+            minutes = hour * 60 - 720
+            decl, eot = solar_position(days + minutes / 1440)
+            tdecl, teot = lookup(table, days, minutes)
+            err_decl = abs(tdecl / UNITS - decl)
+            err_eot = abs(teot / UNITS - eot)
+            worst_decl = max(worst_decl, err_decl)
+            worst_eot = max(worst_eot, err_eot)
+            worst_angle = max(worst_angle, err_decl + err_eot / 4)
+    return worst_decl, worst_eot, worst_angle
+
+
+def write_table(table, stats):
+    flash = len(table) * 4
+    with open(OUTPUT, 'w') as out:
+        out.write('//\n')
+        out.write('// Generated by tools/suntable.py, do not edit.\n')
+        out.write('//\n')
+        out.write('// Solar declination (1/%d degree) and equation of time (1/%d minute)\n' % (UNITS, UNITS))
+        out.write('// at %d steps of the sun\'s mean longitude, %d bytes of flash.\n' % (ENTRIES, flash))
+        out.write('//\n')
+        out.write('// Worst case error against the NOAA formulas, hourly over 2000-2100:\n')
+        out.write('//     declination %.4f degrees, equation of time %.4f minutes,\n' % stats[:2])
+        out.write('//     %.4f degrees of zenith angle.\n' % stats[2])
+        out.write('//\n\n')
+        out.write('#define SUN_TABLE_BITS %d\n\n' % (ENTRIES.bit_length() - 1))
+        out.write('static const int16_t SUN_TABLE_DATA[%d][2] PROGMEM = {\n' % len(table))
+        for k in range(0, len(table), 4):
+            row = ', '.join('{%6d, %6d}' % entry for entry in table[k:k + 4])
+            out.write('    %s%s\n' % (row, ',' if k + 4 < len(table) else ''))
+        out.write('};\n')
+    return flash
+
+
+def main():
+    if ENTRIES & (ENTRIES - 1):
+        sys.exit('entries must be a power of two')
+
+    table = build_table()
+    stats = report(table)
+    flash = write_table(table, stats)
+
+    print('%d entries, %d bytes of flash' % (ENTRIES, flash))
+    print('worst declination error   %.4f degrees' % stats[0])
+    print('worst equation of time    %.4f minutes' % stats[1])
+    print('worst zenith angle error  %.4f degrees' % stats[2])
+    print('wrote %s' % os.path.normpath(OUTPUT))
+
+
+if __name__ == '__main__':
+    main()